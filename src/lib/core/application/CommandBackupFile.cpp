@@ -8,6 +8,8 @@
 
 #include <core/command/CommandStack.hpp>
 
+#include <algorithm>
+
 namespace score
 {
 CommandStackBackup::CommandStackBackup(const CommandStack& stack)
@@ -45,80 +47,108 @@ QString CommandBackupFile::fileName() const
 
 void CommandBackupFile::on_push()
 {
-  /*
-  // A new command is added to m_undoable
-  // m_redoable should be cleared
-  auto cmd = m_stack.m_undoable.last();
-  m_backup.savedUndo.push(CommandData{*cmd});
-
-  m_backup.savedRedo.clear();
+  // A new command is added to m_undoable, m_redoable is cleared
+  if (m_backup.savedUndo.size() + 1 != m_stack.m_undoable.size())
+  {
+    resync();
+  }
+  else
+  {
+    m_backup.savedUndo.push(CommandData{*m_stack.m_undoable.top()});
+    m_backup.savedRedo.clear();
+  }
 
-  m_previousIndex = m_stack.currentIndex();
-  */
   commit();
 }
 
 void CommandBackupFile::on_undo()
 {
-  /*
   // Pop from undoable to redoable
-  m_backup.savedRedo.push(m_savedUndo.pop());
+  if (m_backup.savedUndo.empty()
+      || m_backup.savedUndo.size() != m_stack.m_undoable.size() + 1
+      || m_backup.savedRedo.size() + 1 != m_stack.m_redoable.size())
+  {
+    resync();
+  }
+  else
+  {
+    m_backup.savedRedo.push(m_backup.savedUndo.pop());
+    m_validUndo = std::min(m_validUndo, (int)m_backup.savedUndo.size());
+  }
 
-  m_previousIndex = m_stack.currentIndex();
-  */
   commit();
 }
 
 void CommandBackupFile::on_redo()
 {
-  /*
   // Pop from redoable to undoable
-  m_backup.savedUndo.push(m_savedRedo.pop());
+  if (m_backup.savedRedo.empty()
+      || m_backup.savedRedo.size() != m_stack.m_redoable.size() + 1
+      || m_backup.savedUndo.size() + 1 != m_stack.m_undoable.size())
+  {
+    resync();
+  }
+  else
+  {
+    m_backup.savedUndo.push(m_backup.savedRedo.pop());
+  }
 
-  m_previousIndex = m_stack.currentIndex();
-  */
   commit();
 }
 
 void CommandBackupFile::on_indexChanged()
 {
-  /*
-  // Pop a lot
-  auto index = m_stack.currentIndex();
-  if(index > m_previousIndex)
+  // The individual undo / redo signals have already been processed.
+  if (m_backup.savedUndo.size() != m_stack.m_undoable.size()
+      || m_backup.savedRedo.size() != m_stack.m_redoable.size())
   {
-      for(int i = 0; i < index - m_previousIndex; i++)
-      {
-          m_backup.savedUndo.push(m_savedRedo.pop());
-      }
-  }
-  else if(index < m_previousIndex)
-  {
-      for(int i = 0; i < m_previousIndex - index ; i++)
-      {
-          m_backup.savedRedo.push(m_savedUndo.pop());
-      }
+    resync();
+    commit();
   }
+}
 
-  m_previousIndex = m_stack.currentIndex();
-  */
-  commit();
+void CommandBackupFile::resync()
+{
+  m_backup = CommandStackBackup{m_stack};
+  m_validUndo = 0;
 }
 
 void CommandBackupFile::commit()
 {
-  // OPTIMIZEME: right now all the data is flushed each time.
-  // It should be better to only incrementally modify the file.
-  // See :
-  // http://www.boost.org/doc/libs/1_59_0/doc/html/interprocess/sharedmemorybetweenprocesses.html#interprocess.sharedmemorybetweenprocesses.mapped_file
-
-  // Another possibility would be to save the commands to a db ?
-  m_file.resize(0);
-  m_file.reset();
+  // The layout is the one of DataStreamReader::read(const CommandStack&) :
+  // [undo count] [undo commands...] [redo count] [redo commands...]
+  // Only what comes after the last unchanged undo command is rewritten.
+  const int undo_count = m_backup.savedUndo.size();
+  m_undoOffsets.resize(undo_count + 1);
+  m_undoOffsets[0] = sizeof(int32_t);
+  m_validUndo = std::min(m_validUndo, undo_count);
 
   DataStream::Serializer ser(&m_file);
-  ser.readFrom(m_stack);
+  m_file.seek(m_undoOffsets[m_validUndo]);
+  for (int i = m_validUndo; i < undo_count; i++)
+  {
+    ser.readFrom(m_backup.savedUndo[i]);
+    m_undoOffsets[i + 1] = m_file.pos();
+  }
+  SCORE_DEBUG_INSERT_DELIMITER2(ser);
+
+  ser.stream() << (int32_t)m_backup.savedRedo.size();
+  for (const auto& cmd : m_backup.savedRedo)
+  {
+    ser.readFrom(cmd);
+  }
+  SCORE_DEBUG_INSERT_DELIMITER2(ser);
+
+  ser.insertDelimiter();
 
   m_file.flush();
+  m_file.resize(m_file.pos());
+
+  // Patch the header
+  m_file.seek(0);
+  ser.stream() << (int32_t)undo_count;
+  m_file.flush();
+
+  m_validUndo = undo_count;
 }
 }
@@ -7,6 +7,8 @@
 #include <QString>
 #include <QTemporaryFile>
 
+#include <vector>
+
 namespace score
 {
 class CommandStack;
@@ -29,6 +31,13 @@ struct CommandStackBackup
  *
  * This way, if there is a crash, the document can be restored from the
  * last successful command and only the latest user action is lost.
+ *
+ * Each command is serialized only once, when it is pushed: undo and redo
+ * just move the serialized data between the two stacks.
+ * The file is patched in place: the undo commands which did not change
+ * since the last write are kept on disk, and only the ones after them
+ * (plus the redo stack) are rewritten. Hence a push costs O(command size)
+ * instead of O(history size).
  */
 class CommandBackupFile final : public QObject
 {
@@ -42,12 +51,20 @@ private:
   void on_redo();
   void on_indexChanged();
 
-  //! Writes the current buffers to disk.
+  //! Reloads all the serialized commands if the stack changed behind our back.
+  void resync();
+
+  //! Writes the commands that changed since the last commit to disk.
   void commit();
 
   const score::CommandStack& m_stack;
   CommandStackBackup m_backup;
 
+  //! m_undoOffsets[i] is the file position where the i-th undo command starts
+  std::vector<qint64> m_undoOffsets;
+  //! Number of undo commands which are already correctly written on disk
+  int m_validUndo{};
+
   QTemporaryFile m_file;
 };
 }
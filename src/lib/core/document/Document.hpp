@@ -1,6 +1,7 @@
 #pragma once
 #include <score/document/DocumentContext.hpp>
 #include <score/locking/ObjectLocker.hpp>
+#include <score/model/path/ObjectPathCache.hpp>
 #include <score/selection/FocusManager.hpp>
 #include <score/selection/SelectionStack.hpp>
 
@@ -68,6 +69,9 @@ public:
 
   ObjectLocker& locker() { return m_objectLocker; }
 
+  //! Memoizes the resolution of ObjectPath in this document
+  ObjectPathCache& pathCache() { return m_pathCache; }
+
   const DocumentContext& context() const { return m_context; }
 
   DocumentModel& model() const { return *m_model; }
@@ -130,6 +134,7 @@ private:
   SelectionStack m_selectionStack;
   ObjectLocker m_objectLocker;
   FocusManager m_focus;
+  ObjectPathCache m_pathCache;
   QTimer m_documentUpdateTimer;
   QTimer m_documentCoarseUpdateTimer;
   QTimer m_execTimer;
@@ -6,23 +6,148 @@
 #include <score/serialization/JSONVisitor.hpp>
 #include <score/tools/std/Optional.hpp>
 
+#include <QHash>
 #include <QString>
+#include <QtEndian>
 
 #include <sys/types.h>
 
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+/**
+ * Most paths are made of the same few object names, e.g.
+ * "Scenario::IntervalModel" or "Scenario". In binary serialization
+ * (commands, backups...) these are written as a small tag instead.
+ *
+ * A tagged name is written as the marker followed by a 16-bit tag.
+ * The marker cannot be the start of a serialized QString, since QDataStream
+ * writes the size in bytes of the string, which is always even,
+ * or 0xFFFFFFFF for a null string : older data is still read as-is.
+ */
+constexpr quint32 object_name_tag_marker = 0xFFFFFFFE;
+
+struct ObjectNameTable
+{
+  ObjectNameTable()
+  {
+    // This list is part of the binary format : only ever append to it.
+    names = {QStringLiteral("Scenario::ScenarioDocumentModel"),
+             QStringLiteral("Scenario::BaseScenario"),
+             QStringLiteral("Scenario::IntervalModel"),
+             QStringLiteral("Scenario::EventModel"),
+             QStringLiteral("Scenario::StateModel"),
+             QStringLiteral("Scenario::TimeSyncModel"),
+             QStringLiteral("CommentBlockModel"),
+             QStringLiteral("Process::Cable"),
+             QStringLiteral("Inlet"),
+             QStringLiteral("Outlet"),
+             QStringLiteral("CurveModel"),
+             QStringLiteral("CurvePointModel"),
+             QStringLiteral("CurveSegmentModel"),
+             QStringLiteral("Note"),
+             QStringLiteral("Scenario"),
+             QStringLiteral("Loop"),
+             QStringLiteral("Tempo"),
+             QStringLiteral("Automation"),
+             QStringLiteral("Mapping"),
+             QStringLiteral("Interpolation"),
+             QStringLiteral("InterpState"),
+             QStringLiteral("Spline"),
+             QStringLiteral("Gradient"),
+             QStringLiteral("Metronome"),
+             QStringLiteral("Midi"),
+             QStringLiteral("Pattern"),
+             QStringLiteral("Sound"),
+             QStringLiteral("Effects"),
+             QStringLiteral("Merger"),
+             QStringLiteral("Metro"),
+             QStringLiteral("Step"),
+             QStringLiteral("Javascript"),
+             QStringLiteral("Faust"),
+             QStringLiteral("LV2"),
+             QStringLiteral("VST"),
+             QStringLiteral("ControlSurface"),
+             QStringLiteral("Nodal")};
+
+    tags.reserve(names.size());
+    for (std::size_t i = 0; i < names.size(); i++)
+      tags.insert(names[i], quint16(i));
+  }
+
+  std::vector<QString> names;
+  QHash<QString, quint16> tags;
+};
+
+const ObjectNameTable& objectNameTable()
+{
+  static const ObjectNameTable table;
+  return table;
+}
+
+bool nextIsObjectNameTag(QDataStream& stream)
+{
+  auto dev = stream.device();
+  if (!dev)
+    return false;
+
+  uchar bytes[4];
+  if (dev->peek(reinterpret_cast<char*>(bytes), 4) != 4)
+    return false;
+
+  const quint32 val = stream.byteOrder() == QDataStream::BigEndian
+                          ? qFromBigEndian<quint32>(bytes)
+                          : qFromLittleEndian<quint32>(bytes);
+  return val == object_name_tag_marker;
+}
+}
+
 template <>
 void DataStreamReader::read(const ObjectIdentifier& obj)
 {
-  m_stream << obj.objectName() << obj.id();
+  const auto& table = objectNameTable();
+  auto it = table.tags.find(obj.objectName());
+  if (it != table.tags.end())
+  {
+    m_stream << object_name_tag_marker << *it;
+  }
+  else
+  {
+    m_stream << obj.objectName();
+  }
+  m_stream << obj.id();
 }
 
 template <>
 void DataStreamWriter::write(ObjectIdentifier& obj)
 {
+  const auto& table = objectNameTable();
   QString name;
   int32_t id;
-  m_stream >> name >> id;
-  obj = ObjectIdentifier{name, id};
+
+  if (nextIsObjectNameTag(m_stream_impl))
+  {
+    quint32 marker;
+    quint16 tag;
+    m_stream >> marker >> tag;
+    if (tag >= table.names.size())
+      throw std::runtime_error("Corrupt save file.");
+    name = table.names[tag];
+  }
+  else
+  {
+    m_stream >> name;
+
+    // Share the string data with the table when possible
+    auto it = table.tags.find(name);
+    if (it != table.tags.end())
+      name = table.names[*it];
+  }
+
+  m_stream >> id;
+  obj = ObjectIdentifier{std::move(name), id};
 }
 
 template <>
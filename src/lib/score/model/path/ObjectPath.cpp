@@ -4,6 +4,7 @@
 #include <score/model/IdentifiedObjectAbstract.hpp>
 #include <score/model/path/ObjectIdentifier.hpp>
 #include <score/model/path/ObjectPath.hpp>
+#include <score/model/path/ObjectPathCache.hpp>
 #include <score/tools/std/Optional.hpp>
 
 #include <core/document/Document.hpp>
@@ -155,6 +156,10 @@ QObject* ObjectPath::find_impl(const score::DocumentContext& ctx) const
   QObject* obj = &ctx.document.model();
   SCORE_ASSERT(obj);
 
+  auto& cache = ctx.document.pathCache();
+  if (auto cached = cache.find(*this, obj))
+    return cached;
+
   for (const auto& currentObjIdentifier : m_objectIdentifiers)
   {
     const QObjectList& children = obj->children();
@@ -190,6 +195,7 @@ QObject* ObjectPath::find_impl(const score::DocumentContext& ctx) const
     }
   }
 
+  cache.insert(*this, obj);
   return obj;
 }
 
@@ -199,6 +205,10 @@ QObject* ObjectPath::find_impl_unsafe(const score::DocumentContext& ctx) const n
   QObject* obj = &ctx.document.model();
   SCORE_ASSERT(obj);
 
+  auto& cache = ctx.document.pathCache();
+  if (auto cached = cache.find(*this, obj))
+    return cached;
+
   for (const auto& currentObjIdentifier : m_objectIdentifiers)
   {
     const QObjectList& children = obj->children();
@@ -228,6 +238,7 @@ QObject* ObjectPath::find_impl_unsafe(const score::DocumentContext& ctx) const n
     }
   }
 
+  cache.insert(*this, obj);
   return obj;
 }
 
@@ -0,0 +1,65 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "ObjectPathCache.hpp"
+
+#include <score/model/IdentifiedObjectAbstract.hpp>
+
+#include <algorithm>
+
+namespace score
+{
+static bool matchesHierarchy(
+    const ObjectIdentifierVector& vec,
+    const QObject* obj,
+    const QObject* root) noexcept
+{
+  for (auto it = vec.rbegin(); it != vec.rend(); ++it)
+  {
+    if (!obj || obj->objectName() != it->objectName())
+      return false;
+
+    auto itf = qobject_cast<const IdentifiedObjectAbstract*>(obj);
+    if (!itf || itf->id_val() != it->id())
+      return false;
+
+    obj = obj->parent();
+  }
+
+  return obj == root;
+}
+
+QObject* ObjectPathCache::find(const ObjectPath& path, const QObject* root) const noexcept
+{
+  auto it = m_cache.find(path);
+  if (it == m_cache.end())
+    return nullptr;
+
+  QObject* obj = it->second.data();
+  if (!obj || !matchesHierarchy(path.vec(), obj, root))
+    return nullptr;
+
+  return obj;
+}
+
+void ObjectPathCache::insert(const ObjectPath& path, QObject* obj)
+{
+  m_cache[path] = obj;
+
+  if (m_cache.size() > m_purgeThreshold)
+  {
+    purge();
+    m_purgeThreshold = std::max(std::size_t(1024), 2 * m_cache.size());
+  }
+}
+
+void ObjectPathCache::purge() noexcept
+{
+  for (auto it = m_cache.begin(); it != m_cache.end();)
+  {
+    if (it->second.isNull())
+      it = m_cache.erase(it);
+    else
+      ++it;
+  }
+}
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include <score/model/path/ObjectPath.hpp>
+#include <score/tools/std/HashMap.hpp>
+
+#include <QPointer>
+
+#include <score_lib_base_export.h>
+
+namespace score
+{
+/**
+ * @brief Per-document memoization of ObjectPath resolution.
+ *
+ * Commands re-resolve their paths on each redo / undo, which otherwise
+ * means a linear scan of the children of each object along the path.
+ *
+ * Entries are QPointers, hence a removed (deleted) object is never returned.
+ * A hit is also checked against the parent chain of the object, so that
+ * objects which were moved elsewhere in the hierarchy are resolved again :
+ * a lookup costs O(depth) instead of O(depth * children).
+ */
+class SCORE_LIB_BASE_EXPORT ObjectPathCache
+{
+public:
+  //! Returns the cached object for this path, or nullptr if there is none.
+  QObject* find(const ObjectPath& path, const QObject* root) const noexcept;
+
+  void insert(const ObjectPath& path, QObject* obj);
+
+private:
+  //! Removes the entries of objects which have been deleted
+  void purge() noexcept;
+
+  score::hash_map<ObjectPath, QPointer<QObject>> m_cache;
+  std::size_t m_purgeThreshold{1024};
+};
+}
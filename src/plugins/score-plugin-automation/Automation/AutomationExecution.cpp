@@ -74,25 +74,39 @@ Component::Component(
   node = std::make_shared<ossia::nodes::automation>();
   m_ossia_process = std::make_shared<ossia::nodes::automation_process>(node);
 
+  // Dragging a point changes the curve on each mouse event:
+  // the new curve is sent to the engine at most once per timer period.
+  m_recompute.setSingleShot(true);
+  m_recompute.setInterval(16);
+  connect(&m_recompute, &QTimer::timeout, this, &Component::recompute);
+
   con(element, &Automation::ProcessModel::minChanged, this, [this](const auto&) {
-    this->recompute();
+    this->scheduleRecompute();
   });
   con(element, &Automation::ProcessModel::maxChanged, this, [this](const auto&) {
-    this->recompute();
+    this->scheduleRecompute();
   });
 
   // TODO the tween case will reset the "running" value,
   // so it may not work perfectly.
   con(element, &Automation::ProcessModel::tweenChanged, this, [this](const auto&) {
-    this->recompute();
+    this->scheduleRecompute();
+  });
+  con(element, &Automation::ProcessModel::curveChanged, this, [this]() {
+    this->scheduleRecompute();
   });
-  con(element, &Automation::ProcessModel::curveChanged, this, [this]() { this->recompute(); });
 
   recompute();
 }
 
 Component::~Component() { }
 
+void Component::scheduleRecompute()
+{
+  if (!m_recompute.isActive())
+    m_recompute.start();
+}
+
 void Component::recompute()
 {
   auto dest = Execution::makeDestination(*system().execState, process().address());
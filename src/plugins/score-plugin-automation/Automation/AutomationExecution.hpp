@@ -6,6 +6,8 @@
 #include <ossia/network/value/destination.hpp>
 #include <ossia/network/value/value.hpp>
 
+#include <QTimer>
+
 #include <memory>
 namespace ossia
 {
@@ -31,12 +33,15 @@ public:
 
 private:
   void recompute();
+  void scheduleRecompute();
 
   std::shared_ptr<ossia::curve_abstract>
   on_curveChanged(ossia::val_type, const std::optional<ossia::destination>&);
 
   template <typename T>
   std::shared_ptr<ossia::curve_abstract> on_curveChanged_impl(const std::optional<ossia::destination>&);
+
+  QTimer m_recompute;
 };
 using ComponentFactory = ::Execution::ProcessComponentFactory_T<Component>;
 }
@@ -8,35 +8,99 @@
 #include <score/model/path/Path.hpp>
 #include <score/model/path/PathSerialization.hpp>
 #include <score/serialization/DataStreamVisitor.hpp>
+#include <score/tools/std/HashMap.hpp>
+
+#include <ossia/detail/algorithms.hpp>
 
 namespace Curve
 {
-UpdateCurve::UpdateCurve(const Model& model, std::vector<SegmentData>&& segments)
-    : m_model{std::move(model)}
-    , m_oldCurveData{model.toCurveData()}
-    , m_newCurveData{std::move(segments)}
+namespace
+{
+bool sameSegment(const SegmentData& lhs, const SegmentData& rhs)
+{
+  return lhs.start == rhs.start && lhs.end == rhs.end && lhs.previous == rhs.previous
+         && lhs.following == rhs.following && lhs.type == rhs.type
+         && lhs.specificSegmentData == rhs.specificSegmentData;
+}
+
+// Removes from curve the segments with the ids of removed, and adds added
+std::vector<SegmentData> patch(
+    std::vector<SegmentData> curve,
+    const std::vector<SegmentData>& removed,
+    const std::vector<SegmentData>& added)
+{
+  std::vector<Id<SegmentModel>> ids;
+  ids.reserve(removed.size());
+  for (const auto& seg : removed)
+    ids.push_back(seg.id);
+  std::sort(ids.begin(), ids.end());
+
+  ossia::remove_erase_if(curve, [&](const SegmentData& seg) {
+    return std::binary_search(ids.begin(), ids.end(), seg.id);
+  });
+  curve.insert(curve.end(), added.begin(), added.end());
+  return curve;
+}
+}
+
+UpdateCurve::UpdateCurve(const Model& model, std::vector<SegmentData>&& segments) : m_model{model}
+{
+  update(model, std::move(segments));
+}
+
+void UpdateCurve::update(const Model& model, std::vector<SegmentData>&& segments)
 {
+  // While the command is ongoing, the model is in the state of the previous
+  // call: go back to the original curve to compute the difference.
+  const auto old = patch(model.toCurveData(), m_newSegments, m_oldSegments);
+
+  score::hash_map<Id<SegmentModel>, const SegmentData*> oldById;
+  oldById.reserve(old.size());
+  for (const auto& seg : old)
+    oldById.insert({seg.id, &seg});
+
+  m_oldSegments.clear();
+  m_newSegments.clear();
+  for (auto& seg : segments)
+  {
+    auto it = oldById.find(seg.id);
+    if (it != oldById.end())
+    {
+      if (sameSegment(*it->second, seg))
+      {
+        oldById.erase(it);
+        continue;
+      }
+      m_oldSegments.push_back(*it->second);
+      oldById.erase(it);
+    }
+    m_newSegments.push_back(std::move(seg));
+  }
+
+  // What remains was removed
+  for (const auto& [id, seg] : oldById)
+    m_oldSegments.push_back(*seg);
 }
 
 void UpdateCurve::undo(const score::DocumentContext& ctx) const
 {
   auto& curve = m_model.find(ctx);
-  curve.fromCurveData(m_oldCurveData);
+  curve.fromCurveData(patch(curve.toCurveData(), m_newSegments, m_oldSegments));
 }
 
 void UpdateCurve::redo(const score::DocumentContext& ctx) const
 {
   auto& curve = m_model.find(ctx);
-  curve.fromCurveData(m_newCurveData);
+  curve.fromCurveData(patch(curve.toCurveData(), m_oldSegments, m_newSegments));
 }
 
 void UpdateCurve::serializeImpl(DataStreamInput& s) const
 {
-  s << m_model << m_oldCurveData << m_newCurveData;
+  s << m_model << m_oldSegments << m_newSegments;
 }
 
 void UpdateCurve::deserializeImpl(DataStreamOutput& s)
 {
-  s >> m_model >> m_oldCurveData >> m_newCurveData;
+  s >> m_model >> m_oldSegments >> m_newSegments;
 }
 }
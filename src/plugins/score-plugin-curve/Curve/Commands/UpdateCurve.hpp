@@ -4,7 +4,6 @@
 
 #include <score/command/Command.hpp>
 #include <score/model/path/Path.hpp>
-#include <score/tools/Unused.hpp>
 
 #include <vector>
 
@@ -14,6 +13,14 @@ struct DataStreamOutput;
 namespace Curve
 {
 class Model;
+
+/**
+ * @brief Replaces the segments of a curve.
+ *
+ * Only the segments which differ between the previous and the new curve
+ * are stored, so that the size of the command scales with the edit and not
+ * with the curve.
+ */
 class UpdateCurve final : public score::Command
 {
   SCORE_COMMAND_DECL(CommandFactoryName(), UpdateCurve, "Update Curve")
@@ -23,10 +30,7 @@ public:
   void undo(const score::DocumentContext& ctx) const override;
   void redo(const score::DocumentContext& ctx) const override;
 
-  void update(unused_t, std::vector<SegmentData>&& segments)
-  {
-    m_newCurveData = std::move(segments);
-  }
+  void update(const Model& model, std::vector<SegmentData>&& segments);
 
 protected:
   void serializeImpl(DataStreamInput& s) const override;
@@ -34,7 +38,9 @@ protected:
 
 private:
   Path<Model> m_model;
-  std::vector<SegmentData> m_oldCurveData;
-  std::vector<SegmentData> m_newCurveData;
+  // Segments of the previous curve which were removed or changed
+  std::vector<SegmentData> m_oldSegments;
+  // Segments of the new curve which were added or changed
+  std::vector<SegmentData> m_newSegments;
 };
 }
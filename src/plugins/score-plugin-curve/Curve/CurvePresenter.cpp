@@ -35,7 +35,6 @@
 #include <QMenu>
 #include <QSize>
 #include <QString>
-#include <QVariant>
 #include <qnamespace.h>
 
 #include <wobjectimpl.h>
@@ -92,6 +91,24 @@ void Presenter::setRect(const QRectF& rect)
   {
     setPos(curve_segt);
   }
+
+  updatePointDensity();
+}
+
+void Presenter::updatePointDensity()
+{
+  // Below this average spacing in pixels, point handles overlap and are
+  // only shown for the selected points.
+  static constexpr double min_point_spacing = 6.;
+
+  const auto n = m_points.size();
+  const bool crowded = n > 1 && m_localRect.width() / n < min_point_spacing;
+  if (crowded != m_crowdedPoints)
+  {
+    m_crowdedPoints = crowded;
+    for (auto& pt : m_points)
+      pt.setCrowded(crowded);
+  }
 }
 
 void Presenter::setPos(PointView& point)
@@ -120,9 +137,13 @@ void Presenter::setupSignals()
 
   con(m_model, &Model::pointAdded, this, [&](const PointModel& point) {
     addPoint(new PointView{&point, m_style, m_view});
+    updatePointDensity();
   });
 
-  con(m_model, &Model::pointRemoved, this, [&](const Id<PointModel>& m) { m_points.erase(m); });
+  con(m_model, &Model::pointRemoved, this, [&](const Id<PointModel>& m) {
+    m_points.erase(m);
+    updatePointDensity();
+  });
 
   con(m_model, &Model::segmentRemoved, this, [&](const Id<SegmentModel>& m) {
     m_segments.erase(m);
@@ -244,6 +265,7 @@ void Presenter::addPoint_impl(PointView* pt_view)
   m_points.insert(pt_view);
   setPos(*pt_view);
 
+  pt_view->setCrowded(m_crowdedPoints);
   m_enabled ? pt_view->enable() : pt_view->disable();
 }
 
@@ -386,6 +408,8 @@ void Presenter::modelReset()
   {
     addSegment_impl(seg_view);
   }
+
+  updatePointDensity();
 }
 
 void Presenter::enableActions(bool b)
@@ -533,7 +557,7 @@ void Presenter::removeSelection()
       d.end = QPointF{1, y1};
       d.id = getSegmentId(newSegments);
       d.type = Metadata<ConcreteKey_k, DefaultCurveSegmentModel>::get();
-      d.specificSegmentData = QVariant::fromValue(DefaultCurveSegmentData{});
+      d.specificSegmentData = DefaultCurveSegmentData{};
       newSegments.push_back(d);
     }
     else
@@ -550,7 +574,7 @@ void Presenter::removeSelection()
         d.following = it->id;
         d.id = getSegmentId(newSegments);
         d.type = Metadata<ConcreteKey_k, DefaultCurveSegmentModel>::get();
-        d.specificSegmentData = QVariant::fromValue(DefaultCurveSegmentData{});
+        d.specificSegmentData = DefaultCurveSegmentData{};
         it->previous = d.id;
 
         newSegments.insert(it, d);
@@ -568,7 +592,7 @@ void Presenter::removeSelection()
         d.previous = it->id;
         d.id = getSegmentId(newSegments);
         d.type = Metadata<ConcreteKey_k, DefaultCurveSegmentModel>::get();
-        d.specificSegmentData = QVariant::fromValue(DefaultCurveSegmentData{});
+        d.specificSegmentData = DefaultCurveSegmentData{};
         it->following = d.id;
 
         newSegments.insert(newSegments.end(), d);
@@ -598,7 +622,7 @@ void Presenter::removeSelection()
         d.following = next->id;
         d.id = getSegmentId(newSegments);
         d.type = Metadata<ConcreteKey_k, DefaultCurveSegmentModel>::get();
-        d.specificSegmentData = QVariant::fromValue(DefaultCurveSegmentData{});
+        d.specificSegmentData = DefaultCurveSegmentData{};
         it->following = d.id;
         next->previous = d.id;
 
@@ -99,6 +99,7 @@ private:
   void setupPointConnections(PointView*);
   void setupSegmentConnections(SegmentView*);
   void modelReset();
+  void updatePointDensity();
 
   const SegmentList& m_curveSegments;
   QRectF m_localRect;
@@ -119,5 +120,6 @@ private:
 
   bool m_enabled = true;
   bool m_boundedMove = true;
+  bool m_crowdedPoints = false;
 };
 }
@@ -14,8 +14,6 @@
 #include <score/command/Dispatchers/SingleOngoingCommandDispatcher.hpp>
 #include <score/model/Identifier.hpp>
 
-#include <QVariant>
-
 namespace score
 {
 class CommandStackFacade;
@@ -186,7 +184,7 @@ void CreatePointCommandObject::createPoint(std::vector<SegmentData>& segments)
     }
     SegmentData& newLeftSegment = segments.back();
     newLeftSegment.type = Metadata<ConcreteKey_k, PowerSegment>::get();
-    newLeftSegment.specificSegmentData = QVariant::fromValue(PowerSegmentData{0});
+    newLeftSegment.specificSegmentData = PowerSegmentData{0};
     newLeftSegment.start = {seg_closest_from_left_x, 0.};
     newLeftSegment.end = m_state->currentPoint;
 
@@ -209,7 +207,7 @@ void CreatePointCommandObject::createPoint(std::vector<SegmentData>& segments)
       }
       SegmentData& newRightSegment = segments.back();
       newRightSegment.type = Metadata<ConcreteKey_k, PowerSegment>::get();
-      newRightSegment.specificSegmentData = QVariant::fromValue(PowerSegmentData{0});
+      newRightSegment.specificSegmentData = PowerSegmentData{0};
       newRightSegment.start = m_state->currentPoint;
       newRightSegment.end = {seg_closest_from_right_x, 0.};
 
@@ -84,17 +84,34 @@ void PointView::paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
 void PointView::setSelected(bool selected)
 {
   m_selected = selected;
+  updateVisibility();
   update();
 }
 
 void PointView::enable()
 {
-  this->setVisible(true);
+  m_enabled = true;
+  updateVisibility();
 }
 
 void PointView::disable()
 {
-  this->setVisible(false);
+  m_enabled = false;
+  updateVisibility();
+}
+
+void PointView::setCrowded(bool crowded)
+{
+  if (crowded != m_crowded)
+  {
+    m_crowded = crowded;
+    updateVisibility();
+  }
+}
+
+void PointView::updateVisibility()
+{
+  this->setVisible(m_enabled && (!m_crowded || m_selected));
 }
 
 void PointView::contextMenuEvent(QGraphicsSceneContextMenuEvent* ev)
@@ -39,6 +39,9 @@ public:
   void enable();
   void disable();
 
+  // When points are too close to each other, only the selected ones are shown
+  void setCrowded(bool crowded);
+
   void setModel(const PointModel* model);
 
 public:
@@ -48,9 +51,13 @@ protected:
   void contextMenuEvent(QGraphicsSceneContextMenuEvent*) override;
 
 private:
+  void updateVisibility();
+
   const PointModel* m_model;
   const Curve::Style& m_style;
   bool m_selected{};
+  bool m_enabled{true};
+  bool m_crowded{};
 };
 }
 
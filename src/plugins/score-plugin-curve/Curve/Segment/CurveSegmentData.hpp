@@ -7,7 +7,14 @@
 
 #include <ossia/detail/algorithms.hpp>
 
+#include <QPointF>
 #include <QVariant>
+#include <QVector>
+
+#include <score_plugin_curve_export.h>
+
+#include <type_traits>
+#include <variant>
 
 namespace Curve
 {
@@ -58,6 +65,93 @@ class SegmentId
 };*/
 
 // An object wrapper useful for saving / loading
+struct SCORE_PLUGIN_CURVE_EXPORT LinearSegmentData
+{
+  friend bool operator==(const LinearSegmentData&, const LinearSegmentData&) noexcept
+  {
+    return true;
+  }
+};
+
+struct SCORE_PLUGIN_CURVE_EXPORT PowerSegmentData
+{
+  PowerSegmentData() = default;
+  PowerSegmentData(double d) : gamma{d} { }
+
+  // Value of gamma for which the pow will be == 1.
+  static const constexpr double linearGamma = 1;
+  double gamma = linearGamma;
+
+  friend bool operator==(const PowerSegmentData& lhs, const PowerSegmentData& rhs) noexcept
+  {
+    return lhs.gamma == rhs.gamma;
+  }
+};
+
+struct EasingData
+{
+  friend bool operator==(const EasingData&, const EasingData&) noexcept { return true; }
+};
+
+struct PointArraySegmentData
+{
+  double min_x, max_x;
+  double min_y, max_y;
+  QVector<QPointF> m_points;
+
+  friend bool
+  operator==(const PointArraySegmentData& lhs, const PointArraySegmentData& rhs) noexcept
+  {
+    return lhs.min_x == rhs.min_x && lhs.max_x == rhs.max_x && lhs.min_y == rhs.min_y
+           && lhs.max_y == rhs.max_y && lhs.m_points == rhs.m_points;
+  }
+};
+
+/**
+ * @brief Parameters specific to each kind of segment.
+ *
+ * The segments of this plug-in are stored directly ; segments provided by
+ * other plug-ins store their data in the QVariant.
+ */
+using SegmentSpecificData = std::variant<
+    LinearSegmentData,
+    PowerSegmentData,
+    EasingData,
+    PointArraySegmentData,
+    QVariant>;
+
+template <typename T>
+constexpr bool is_builtin_segment_data = std::is_same_v<T, LinearSegmentData>
+                                         || std::is_same_v<T, PowerSegmentData>
+                                         || std::is_same_v<T, EasingData>
+                                         || std::is_same_v<T, PointArraySegmentData>;
+
+template <typename T>
+SegmentSpecificData makeSegmentSpecificData(T&& data)
+{
+  if constexpr (is_builtin_segment_data<std::decay_t<T>>)
+    return SegmentSpecificData{std::forward<T>(data)};
+  else
+    return QVariant::fromValue(std::forward<T>(data));
+}
+
+//! Returns a default-constructed T if data holds another type
+template <typename T>
+T segmentSpecificData(const SegmentSpecificData& data)
+{
+  if constexpr (is_builtin_segment_data<T>)
+  {
+    if (auto ptr = std::get_if<T>(&data))
+      return *ptr;
+  }
+  else
+  {
+    if (auto var = std::get_if<QVariant>(&data))
+      return var->value<T>();
+  }
+  return T{};
+}
+
 struct SegmentData
 {
   SegmentData() = default;
@@ -73,7 +167,7 @@ struct SegmentData
       OptionalId<SegmentModel> prev,
       OptionalId<SegmentModel> foll,
       const UuidKey<Curve::SegmentFactory>& t,
-      QVariant data)
+      SegmentSpecificData data)
       : id(std::move(i))
       , start(s)
       , end(e)
@@ -90,7 +184,7 @@ struct SegmentData
   OptionalId<SegmentModel> previous, following;
 
   UuidKey<Curve::SegmentFactory> type;
-  QVariant specificSegmentData;
+  SegmentSpecificData specificSegmentData;
 
   double x() const { return start.x(); }
 };
@@ -181,6 +275,15 @@ enum Segments
 };
 }
 
+Q_DECLARE_METATYPE(Curve::LinearSegmentData)
+W_REGISTER_ARGTYPE(Curve::LinearSegmentData)
+Q_DECLARE_METATYPE(Curve::PowerSegmentData)
+W_REGISTER_ARGTYPE(Curve::PowerSegmentData)
+Q_DECLARE_METATYPE(Curve::EasingData)
+W_REGISTER_ARGTYPE(Curve::EasingData)
+Q_DECLARE_METATYPE(Curve::PointArraySegmentData)
+W_REGISTER_ARGTYPE(Curve::PointArraySegmentData)
+
 Q_DECLARE_METATYPE(Curve::SegmentData)
 W_REGISTER_ARGTYPE(Curve::SegmentData)
 
@@ -1,11 +1,12 @@
 #pragma once
 
+#include <Curve/Segment/CurveSegmentData.hpp>
+
 #include <score/model/Identifier.hpp>
 #include <score/plugins/Interface.hpp>
 #include <score/serialization/VisitorCommon.hpp>
 
 #include <QString>
-#include <QVariant>
 
 #include <score_plugin_curve_export.h>
 
@@ -32,11 +33,12 @@ public:
 
   virtual SegmentModel* load(const SegmentData& data, QObject* parent) = 0;
 
-  virtual QVariant makeCurveSegmentData() const = 0;
+  virtual SegmentSpecificData makeCurveSegmentData() const = 0;
 
-  virtual void
-  serializeCurveSegmentData(const QVariant& data, const VisitorVariant& visitor) const = 0;
-  virtual QVariant makeCurveSegmentData(const VisitorVariant& visitor) const = 0;
+  virtual void serializeCurveSegmentData(
+      const SegmentSpecificData& data,
+      const VisitorVariant& visitor) const = 0;
+  virtual SegmentSpecificData makeCurveSegmentData(const VisitorVariant& visitor) const = 0;
 };
 
 template <typename T>
@@ -62,20 +64,20 @@ public:
     return new T{dat, parent};
   }
 
-  QVariant makeCurveSegmentData() const override
+  SegmentSpecificData makeCurveSegmentData() const override
   {
-    return QVariant::fromValue(typename T::data_type{});
+    return makeSegmentSpecificData(typename T::data_type{});
   }
 
-  void
-  serializeCurveSegmentData(const QVariant& data, const VisitorVariant& visitor) const override
+  void serializeCurveSegmentData(const SegmentSpecificData& data, const VisitorVariant& visitor)
+      const override
   {
-    score::serialize_dyn(visitor, data.value<typename T::data_type>());
+    score::serialize_dyn(visitor, segmentSpecificData<typename T::data_type>(data));
   }
 
-  QVariant makeCurveSegmentData(const VisitorVariant& vis) const override
+  SegmentSpecificData makeCurveSegmentData(const VisitorVariant& vis) const override
   {
-    return QVariant::fromValue(score::deserialize_dyn<typename T::data_type>(vis));
+    return makeSegmentSpecificData(score::deserialize_dyn<typename T::data_type>(vis));
   }
 
   UuidKey<Curve::SegmentFactory> concreteKey() const noexcept override
@@ -91,7 +91,7 @@ protected:
   virtual void on_startChanged() = 0;
   virtual void on_endChanged() = 0;
 
-  virtual QVariant toSegmentSpecificData() const = 0;
+  virtual SegmentSpecificData toSegmentSpecificData() const = 0;
 
   mutable data_vector m_data; // A data cache.
   mutable bool m_valid{};     // Used to perform caching.
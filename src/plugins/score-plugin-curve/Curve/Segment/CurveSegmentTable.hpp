@@ -0,0 +1,73 @@
+#pragma once
+#include <ossia/editor/curve/curve_segment.hpp>
+#include <ossia/editor/curve/curve_segment/easing.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace Curve
+{
+/**
+ * @brief Shape of a segment sampled over [0; 1].
+ *
+ * Evaluating it is a clamp and a linear interpolation between two samples,
+ * which is much cheaper on the audio thread than the transcendental
+ * functions some easings are made of.
+ * It is only meant for shapes with a bounded slope, the error being
+ * proportional to their curvature.
+ */
+class SegmentTable
+{
+public:
+  static constexpr int size = 1024;
+
+  template <typename F>
+  explicit SegmentTable(F shape) noexcept
+  {
+    for (int i = 0; i <= size; i++)
+      m_values[i] = shape(double(i) / size);
+  }
+
+  double operator()(double ratio) const noexcept
+  {
+    const double pos = std::clamp(ratio, 0., 1.) * size;
+    const int i = std::min(int(pos), size - 1);
+    return m_values[i] + (pos - i) * (m_values[i + 1] - m_values[i]);
+  }
+
+private:
+  std::array<double, size + 1> m_values;
+};
+
+//! Easings which are expensive enough to be worth tabulating
+template <typename Easing_T>
+constexpr bool tabulated_easing = false;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::sineIn> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::sineOut> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::sineInOut> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::exponentialIn> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::exponentialOut> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::exponentialInOut> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::elasticIn> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::elasticOut> = true;
+template <>
+inline constexpr bool tabulated_easing<ossia::easing::elasticInOut> = true;
+
+//! Segment function interpolating between start and end along a table
+template <typename Y>
+ossia::curve_segment<Y> tabulatedFunction(std::shared_ptr<const SegmentTable> table)
+{
+  return [table = std::move(table)](double ratio, Y start, Y end) {
+    return ossia::easing::ease{}(start, end, (*table)(ratio));
+  };
+}
+}
@@ -96,6 +96,23 @@ bool SegmentView::contains(const QPointF& pt) const
 
 void SegmentView::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
+  if (m_rect.width() < 2.)
+  {
+    // Recorded automations have many segments narrower than a pixel:
+    // stroking each path is expensive and indistinguishable from a line.
+    if (m_unstrokedShape.isEmpty())
+      return;
+
+    painter->setRenderHint(QPainter::RenderHint::Antialiasing, false);
+    painter->setPen(*m_pen);
+    const auto r = m_unstrokedShape.controlPointRect();
+    if (r.height() < 1.)
+      painter->drawLine(m_unstrokedShape.elementAt(0), m_unstrokedShape.currentPosition());
+    else
+      painter->drawLine(r.topLeft(), r.bottomLeft());
+    return;
+  }
+
   painter->setRenderHint(QPainter::RenderHint::Antialiasing, m_enabled && m_rect.width() > 10);
   painter->strokePath(m_unstrokedShape, *m_pen);
   painter->setRenderHint(QPainter::RenderHint::Antialiasing, false);
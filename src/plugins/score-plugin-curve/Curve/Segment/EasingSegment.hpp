@@ -1,15 +1,12 @@
 #pragma once
 #include <Curve/Segment/CurveSegmentFactory.hpp>
 #include <Curve/Segment/CurveSegmentModel.hpp>
+#include <Curve/Segment/CurveSegmentTable.hpp>
 
 #include <ossia/editor/curve/curve_segment/easing.hpp>
 
 namespace Curve
 {
-struct EasingData
-{
-};
-
 template <typename Easing_T>
 class EasingSegment final : public ::Curve::SegmentModel
 {
@@ -78,12 +75,21 @@ public:
   void setVerticalParameter(double p) override { }
   void setHorizontalParameter(double p) override { }
 
-  QVariant toSegmentSpecificData() const override { return QVariant::fromValue(EasingData{}); }
+  SegmentSpecificData toSegmentSpecificData() const override { return EasingData{}; }
 
   template <typename Y>
   ossia::curve_segment<Y> makeFunction() const
   {
-    return ossia::curve_segment_ease<Y, Easing_T>{};
+    if constexpr (tabulated_easing<Easing_T>)
+    {
+      // The shape does not depend on the segment: sample it once per easing
+      static const auto table = std::make_shared<const SegmentTable>(Easing_T{});
+      return tabulatedFunction<Y>(table);
+    }
+    else
+    {
+      return ossia::curve_segment_ease<Y, Easing_T>{};
+    }
   }
   ossia::curve_segment<double> makeDoubleFunction() const override
   {
@@ -145,8 +151,6 @@ inline void JSONWriter::write(Curve::EasingData& segmt)
 {
 }
 
-Q_DECLARE_METATYPE(Curve::EasingData)
-W_REGISTER_ARGTYPE(Curve::EasingData)
 
 // cat easings | xargs -L1 bash -c 'echo $(uuidgen)' | paste - easings | sed
 // 's/\t/ /' > easings2
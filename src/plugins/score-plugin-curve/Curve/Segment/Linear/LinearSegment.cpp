@@ -49,9 +49,9 @@ double LinearSegment::valueAt(double x) const
   return start().y() + (end().y() - start().y()) * (x - start().x()) / (end().x() - start().x());
 }
 
-QVariant LinearSegment::toSegmentSpecificData() const
+SegmentSpecificData LinearSegment::toSegmentSpecificData() const
 {
-  return QVariant::fromValue(data_type{});
+  return data_type{};
 }
 
 ossia::curve_segment<double> LinearSegment::makeDoubleFunction() const
@@ -18,10 +18,6 @@ CURVE_SEGMENT_METADATA(
 
 namespace Curve
 {
-struct SCORE_PLUGIN_CURVE_EXPORT LinearSegmentData
-{
-};
-
 class SCORE_PLUGIN_CURVE_EXPORT LinearSegment final : public SegmentModel
 {
   MODEL_METADATA_IMPL(LinearSegment)
@@ -47,7 +43,7 @@ public:
   void updateData(int numInterp) const override;
   double valueAt(double x) const override;
 
-  QVariant toSegmentSpecificData() const override;
+  SegmentSpecificData toSegmentSpecificData() const override;
 
   ossia::curve_segment<double> makeDoubleFunction() const override;
   ossia::curve_segment<float> makeFloatFunction() const override;
@@ -55,5 +51,3 @@ public:
 };
 }
 
-Q_DECLARE_METATYPE(Curve::LinearSegmentData)
-W_REGISTER_ARGTYPE(Curve::LinearSegmentData)
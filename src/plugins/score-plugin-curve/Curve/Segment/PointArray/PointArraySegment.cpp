@@ -27,7 +27,7 @@ namespace Curve
 PointArraySegment::PointArraySegment(const SegmentData& dat, QObject* parent)
     : SegmentModel{dat, parent}
 {
-  const auto& pa_data = dat.specificSegmentData.value<PointArraySegmentData>();
+  const auto pa_data = segmentSpecificData<PointArraySegmentData>(dat.specificSegmentData);
   min_x = pa_data.min_x;
   max_x = pa_data.max_x;
   min_y = pa_data.min_y;
@@ -176,30 +176,41 @@ void PointArraySegment::addPointUnscaled(double x, double y)
 
 void PointArraySegment::simplify(double ratio)
 {
+  simplify(ratio, 0);
+}
+
+std::size_t PointArraySegment::simplify(double ratio, std::size_t first)
+{
+  if (m_points.size() < first + 3)
+    return first;
+
   double tolerance = (max_y - min_y) / ratio;
 
+  const auto begin = m_points.begin() + first;
   ossia::double_vector orig;
-  orig.reserve(m_points.size() * 2);
-  for (const auto& pt : m_points)
+  orig.reserve((m_points.size() - first) * 2);
+  for (auto it = begin; it != m_points.end(); ++it)
   {
-    orig.push_back(pt.first);
-    orig.push_back(pt.second);
+    orig.push_back(it->first);
+    orig.push_back(it->second);
   }
 
   ossia::double_vector result;
-  result.reserve(m_points.size() / 2);
+  result.reserve((m_points.size() - first) / 2);
 
   psimpl::simplify_reumann_witkam<2>(
       orig.begin(), orig.end(), tolerance, std::back_inserter(result));
   SCORE_ASSERT(result.size() > 0);
   SCORE_ASSERT(result.size() % 2 == 0);
 
-  m_points.clear();
-  // m_points.container.reserve(result.size() / 2);
+  m_points.erase(begin, m_points.end());
   for (auto i = 0u; i < result.size(); i += 2)
   {
     m_points.insert(std::make_pair(result[i], result[i + 1]));
   }
+
+  m_valid = false;
+  return m_points.size() - 1;
 }
 
 std::vector<SegmentData> PointArraySegment::toLinearSegments() const
@@ -218,7 +229,7 @@ std::vector<SegmentData> PointArraySegment::toLinearSegments() const
       std::nullopt,
       std::nullopt,
       Metadata<ConcreteKey_k, LinearSegment>::get(),
-      QVariant::fromValue(LinearSegmentData{}));
+      LinearSegmentData{});
 
   int size = pts.size();
   for (int i = 1; i < size - 1; i++)
@@ -233,7 +244,7 @@ std::vector<SegmentData> PointArraySegment::toLinearSegments() const
         Id<SegmentModel>{k - 1},
         std::nullopt,
         Metadata<ConcreteKey_k, LinearSegment>::get(),
-        QVariant::fromValue(LinearSegmentData()));
+        LinearSegmentData{});
   }
 
   return vec;
@@ -255,7 +266,7 @@ std::vector<SegmentData> PointArraySegment::toPowerSegments() const
       std::nullopt,
       std::nullopt,
       Metadata<ConcreteKey_k, PowerSegment>::get(),
-      QVariant::fromValue(PowerSegmentData{}));
+      PowerSegmentData{});
 
   int size = pts.size();
   for (int i = 1; i < size - 1; i++)
@@ -270,7 +281,7 @@ std::vector<SegmentData> PointArraySegment::toPowerSegments() const
         Id<SegmentModel>{k - 1},
         OptionalId<SegmentModel>{},
         Metadata<ConcreteKey_k, PowerSegment>::get(),
-        QVariant::fromValue(PowerSegmentData()));
+        PowerSegmentData{});
   }
 
   return vec;
@@ -35,12 +35,6 @@ namespace Curve
 {
 class LinearSegment;
 struct SegmentData;
-struct PointArraySegmentData
-{
-  double min_x, max_x;
-  double min_y, max_y;
-  QVector<QPointF> m_points;
-};
 class SCORE_PLUGIN_CURVE_EXPORT PointArraySegment final : public SegmentModel
 {
   W_OBJECT(PointArraySegment)
@@ -73,6 +67,11 @@ public:
   void addPoint(double, double);
   void addPointUnscaled(double, double);
   void simplify(double ratio); // 10 is a good ratio
+
+  //! Simplifies the points from index first onwards, leaving the previous
+  //! ones untouched. Returns the index of the last point, from which the
+  //! next pass can resume as more points are added.
+  std::size_t simplify(double ratio, std::size_t first);
   std::vector<SegmentData> toLinearSegments() const;
   std::vector<SegmentData> toPowerSegments() const;
 
@@ -86,7 +85,7 @@ public:
 
   const auto& points() const { return m_points; }
 
-  QVariant toSegmentSpecificData() const override
+  SegmentSpecificData toSegmentSpecificData() const override
   {
     PointArraySegmentData dat{min_x, max_x, min_y, max_y, {}};
 
@@ -94,7 +93,7 @@ public:
     for (const auto& pt : m_points)
       dat.m_points.push_back({pt.first, pt.second});
 
-    return QVariant::fromValue(std::move(dat));
+    return dat;
   }
 
   // This will throw if execution is attempted.
@@ -118,5 +117,3 @@ private:
 };
 }
 
-Q_DECLARE_METATYPE(Curve::PointArraySegmentData)
-W_REGISTER_ARGTYPE(Curve::PointArraySegmentData)
@@ -16,7 +16,8 @@ namespace Curve
 {
 
 PowerSegment::PowerSegment(const SegmentData& dat, QObject* parent)
-    : SegmentModel{dat, parent}, gamma{dat.specificSegmentData.value<PowerSegmentData>().gamma}
+    : SegmentModel{dat, parent}
+    , gamma{segmentSpecificData<PowerSegmentData>(dat.specificSegmentData).gamma}
 {
 }
 
@@ -107,9 +108,9 @@ void PowerSegment::setVerticalParameter(double p)
   dataChanged();
 }
 
-QVariant PowerSegment::toSegmentSpecificData() const
+SegmentSpecificData PowerSegment::toSegmentSpecificData() const
 {
-  return QVariant::fromValue(PowerSegmentData(gamma));
+  return PowerSegmentData(gamma);
 }
 
 template <typename Y>
@@ -24,16 +24,6 @@ CURVE_SEGMENT_METADATA(
 namespace Curve
 {
 struct SegmentData;
-struct SCORE_PLUGIN_CURVE_EXPORT PowerSegmentData
-{
-  PowerSegmentData() = default;
-  PowerSegmentData(double d) : gamma{d} { }
-
-  // Value of gamma for which the pow will be == 1.
-  static const constexpr double linearGamma = 1;
-  double gamma = linearGamma;
-};
-
 class SCORE_PLUGIN_CURVE_EXPORT PowerSegment final : public SegmentModel
 {
   MODEL_METADATA_IMPL(PowerSegment)
@@ -65,7 +55,7 @@ private:
   std::optional<double> verticalParameter() const override;
   void setVerticalParameter(double p) override;
 
-  QVariant toSegmentSpecificData() const override;
+  SegmentSpecificData toSegmentSpecificData() const override;
 
   template <typename Y>
   ossia::curve_segment<Y> makeFunction() const;
@@ -76,5 +66,3 @@ private:
 };
 }
 
-Q_DECLARE_METATYPE(Curve::PowerSegmentData)
-W_REGISTER_ARGTYPE(Curve::PowerSegmentData)
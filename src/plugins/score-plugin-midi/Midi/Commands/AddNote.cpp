@@ -64,11 +64,8 @@ ReplaceNotes::ReplaceNotes(
 void ReplaceNotes::undo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
-  model.notes.clear();
   model.setDuration(m_olddur);
-
-  for (auto& note : m_old)
-    model.notes.add(new Note{note.first, note.second, &model});
+  model.replaceNotes(m_old);
 
   model.setRange(m_oldmin, m_oldmax);
 }
@@ -76,11 +73,8 @@ void ReplaceNotes::undo(const score::DocumentContext& ctx) const
 void ReplaceNotes::redo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
-  model.notes.clear();
   model.setDuration(m_newdur);
-
-  for (auto& note : m_new)
-    model.notes.add(new Note{note.first, note.second, &model});
+  model.replaceNotes(m_new);
 
   model.setRange(m_newmin, m_newmax);
 }
@@ -5,12 +5,27 @@
 #include <Midi/MidiProcess.hpp>
 
 #include <ossia/dataflow/nodes/midi.hpp>
+
+#include <QTimer>
 namespace Midi
 {
 namespace Executor
 {
 using midi_node = ossia::nodes::midi;
 using midi_node_process = ossia::nodes::midi_node_process;
+
+struct Component::NoteEdit
+{
+  enum
+  {
+    Add,
+    Remove,
+    Update
+  } type;
+  ossia::nodes::note_data old;
+  ossia::nodes::note_data cur;
+};
+
 Component::Component(
     Midi::ProcessModel& element,
     const Execution::Context& ctx,
@@ -42,22 +57,15 @@ Component::Component(
       notes.insert(to_note(data));
     }
 
+    // The whole set is replaced: pending edits are superseded
+    m_pendingEdits.clear();
     in_exec([n = std::move(notes), midi]() mutable { midi->set_notes(std::move(n)); });
   };
   set_notes();
 
   element.notes.added.connect<&Component::on_noteAdded>(this);
   element.notes.removing.connect<&Component::on_noteRemoved>(this);
-
-  for (auto& note : element.notes)
-  {
-    QObject::connect(
-        &note, &Note::noteChanged, this, [&, midi, cur = to_note(note.noteData())]() mutable {
-          auto old = cur;
-          cur = to_note(note.noteData());
-          in_exec([old, cur, midi] { midi->update_note(old, cur); });
-        });
-  }
+  element.noteChanged.connect<&Component::on_noteChanged>(this);
   QObject::connect(&element, &Midi::ProcessModel::notesChanged, this, set_notes);
 }
 
@@ -65,20 +73,52 @@ Component::~Component() { }
 
 void Component::on_noteAdded(const Note& n)
 {
-  auto midi = std::dynamic_pointer_cast<midi_node>(node);
-  in_exec([nd = to_note(n.noteData()), midi] { midi->add_note(nd); });
-
-  QObject::connect(&n, &Note::noteChanged, this, [&, midi, cur = to_note(n.noteData())]() mutable {
-    auto old = cur;
-    cur = to_note(n.noteData());
-    in_exec([old, cur, midi] { midi->update_note(old, cur); });
-  });
+  queueEdit({NoteEdit::Add, {}, to_note(n.noteData())});
 }
 
 void Component::on_noteRemoved(const Note& n)
 {
+  queueEdit({NoteEdit::Remove, to_note(n.noteData()), {}});
+}
+
+void Component::on_noteChanged(const Note& n, const NoteData& old)
+{
+  queueEdit({NoteEdit::Update, to_note(old), to_note(n.noteData())});
+}
+
+void Component::queueEdit(NoteEdit&& e)
+{
+  // Commands such as transposing a selection change many notes in a row:
+  // the edits are gathered and sent to the engine in a single message.
+  if (m_pendingEdits.empty())
+    QTimer::singleShot(0, this, &Component::flushEdits);
+  m_pendingEdits.push_back(std::move(e));
+}
+
+void Component::flushEdits()
+{
+  if (m_pendingEdits.empty())
+    return;
+
   auto midi = std::dynamic_pointer_cast<midi_node>(node);
-  in_exec([nd = to_note(n.noteData()), midi] { midi->remove_note(nd); });
+  in_exec([edits = std::move(m_pendingEdits), midi] {
+    for (const NoteEdit& e : edits)
+    {
+      switch (e.type)
+      {
+        case NoteEdit::Add:
+          midi->add_note(e.cur);
+          break;
+        case NoteEdit::Remove:
+          midi->remove_note(e.old);
+          break;
+        case NoteEdit::Update:
+          midi->update_note(e.old, e.cur);
+          break;
+      }
+    }
+  });
+  m_pendingEdits.clear();
 }
 
 ossia::nodes::note_data Component::to_note(const NoteData& n)
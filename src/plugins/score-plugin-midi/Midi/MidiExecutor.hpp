@@ -35,10 +35,17 @@ public:
   ~Component() override;
 
 private:
+  struct NoteEdit;
+
   void on_noteAdded(const Midi::Note&);
   void on_noteRemoved(const Midi::Note&);
+  void on_noteChanged(const Midi::Note&, const NoteData& old);
+  void queueEdit(NoteEdit&& e);
+  void flushEdits();
 
   ossia::nodes::note_data to_note(const NoteData& n);
+
+  std::vector<NoteEdit> m_pendingEdits;
 };
 
 using ComponentFactory = ::Execution::ProcessComponentFactory_T<Component>;
@@ -2,6 +2,8 @@
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 #include "MidiNote.hpp"
 
+#include <Midi/MidiProcess.hpp>
+
 #include <wobjectimpl.h>
 W_OBJECT_IMPL(Midi::Note)
 
@@ -26,9 +28,10 @@ void Note::scale(double s) noexcept
 {
   if (s != 1.)
   {
+    const auto old = noteData();
     m_start *= s;
     m_duration *= s;
-    noteChanged();
+    changed(old);
   }
 }
 
@@ -36,8 +39,9 @@ void Note::setStart(double s) noexcept
 {
   if (m_start != s)
   {
+    const auto old = noteData();
     m_start = s;
-    noteChanged();
+    changed(old);
   }
 }
 
@@ -45,8 +49,9 @@ void Note::setDuration(double s) noexcept
 {
   if (m_duration != s)
   {
+    const auto old = noteData();
     m_duration = s;
-    noteChanged();
+    changed(old);
   }
 }
 
@@ -54,8 +59,9 @@ void Note::setPitch(midi_size_t s) noexcept
 {
   if (m_pitch != s)
   {
+    const auto old = noteData();
     m_pitch = s;
-    noteChanged();
+    changed(old);
   }
 }
 
@@ -63,8 +69,9 @@ void Note::setVelocity(midi_size_t s) noexcept
 {
   if (m_velocity != s)
   {
+    const auto old = noteData();
     m_velocity = s;
-    noteChanged();
+    changed(old);
   }
 }
 
@@ -75,11 +82,19 @@ NoteData Note::noteData() const noexcept
 
 void Note::setData(NoteData d) noexcept
 {
+  const auto old = noteData();
   m_start = d.m_start;
   m_duration = d.m_duration;
   m_pitch = d.m_pitch;
   m_velocity = d.m_velocity;
 
+  changed(old);
+}
+
+void Note::changed(const NoteData& old) noexcept
+{
   noteChanged();
+  if (auto proc = qobject_cast<ProcessModel*>(parent()))
+    proc->noteChanged(*this, old);
 }
 }
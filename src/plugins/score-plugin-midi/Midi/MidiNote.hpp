@@ -99,6 +99,8 @@ public:
   void noteChanged() W_SIGNAL(noteChanged);
 
 private:
+  void changed(const NoteData& old) noexcept;
+
   double m_start{};
   double m_duration{};
 
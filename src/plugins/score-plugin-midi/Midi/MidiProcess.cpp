@@ -81,6 +81,29 @@ void ProcessModel::setRange(int min, int max)
   }
 }
 
+void ProcessModel::replaceNotes(const std::vector<std::pair<Id<Note>, NoteData>>& newNotes)
+{
+  // Going through notes.add / notes.remove would send one signal per note
+  // to the views and the execution component, which is very slow for large
+  // MIDI files. Instead the whole set is swapped and notesChanged is sent
+  // once; the old notes are only deleted afterwards, so that listeners
+  // can still tear down what refers to them.
+  std::vector<Note*> old;
+  old.reserve(notes.size());
+  for (Note& n : notes)
+    old.push_back(&n);
+
+  auto& map = notes.unsafe_map();
+  map.clear();
+  for (const auto& [id, data] : newNotes)
+    map.insert(new Note{id, data, this});
+
+  notesChanged();
+
+  for (Note* n : old)
+    delete n;
+}
+
 void ProcessModel::setDurationAndScale(const TimeVal& newDuration) noexcept
 {
   setDuration(newDuration);
@@ -35,6 +35,12 @@ public:
 
   score::EntityMap<Note> notes;
 
+  //! Sent with the previous data of the note whenever one of them changes
+  mutable Nano::Signal<void(const Note&, const NoteData&)> noteChanged;
+
+  //! Replaces all the notes at once, with a single notesChanged
+  void replaceNotes(const std::vector<std::pair<Id<Note>, NoteData>>& newNotes);
+
   void setChannel(int n);
   int channel() const;
 
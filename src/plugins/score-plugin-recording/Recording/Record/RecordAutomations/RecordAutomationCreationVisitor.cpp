@@ -38,8 +38,7 @@ RecordData RecordAutomationCreationVisitor::makeCurve(float start_y)
   seg.id = Id<Curve::SegmentModel>{0};
   seg.start = {0, start_y};
   seg.end = {1, -1};
-  seg.specificSegmentData
-      = QVariant::fromValue(Curve::PointArraySegmentData{0, 1, min, max, {{0, start_y}}});
+  seg.specificSegmentData = Curve::PointArraySegmentData{0, 1, min, max, {{0, start_y}}};
   auto segt = new Curve::PointArraySegment{seg, &autom.curve()};
 
   segt->setStart({0, start_y});
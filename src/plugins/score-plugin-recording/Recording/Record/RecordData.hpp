@@ -41,5 +41,8 @@ struct RecordData
   Curve::PointArraySegment& segment;
 
   State::Unit unit;
+
+  //! Index up to which the segment has already been simplified
+  std::size_t simplified{};
 };
 }
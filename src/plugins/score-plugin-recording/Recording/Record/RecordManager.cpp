@@ -69,6 +69,14 @@ namespace Recording
 AutomationRecorder::AutomationRecorder(RecordContext& ctx)
     : context{ctx}, m_settings{context.context.app.settings<Curve::Settings::Model>()}
 {
+  // Simplify the curves while they are being recorded, so that they do not
+  // grow without bound and that stopping only has the last bit to process.
+  m_simplifyTimer.setInterval(1000);
+  connect(&m_simplifyTimer, &QTimer::timeout, this, &AutomationRecorder::simplifyRecords);
+
+  m_receiveTimer.setInterval(8);
+  connect(
+      &m_receiveTimer, &QTimer::timeout, this, &AutomationRecorder::processReceivedValues);
 }
 
 bool AutomationRecorder::setup(const Box& box, const RecordListening& recordListening)
@@ -90,8 +98,7 @@ bool AutomationRecorder::setup(const Box& box, const RecordListening& recordList
   const auto& devicelist = context.explorer.deviceModel().list();
 
   //// Setup listening on the curves ////
-  const auto curve_mode = m_settings.getCurveMode();
-  m_recordingMode = curve_mode;
+  m_recordingMode = m_settings.getCurveMode();
   int i = 0;
   for (const auto& vec : recordListening)
   {
@@ -101,43 +108,37 @@ bool AutomationRecorder::setup(const Box& box, const RecordListening& recordList
 
     dev.addToListening(addresses[i]);
     // Add a custom callback.
-    if (curve_mode == Curve::Settings::Mode::Parameter)
-    {
-      dev.valueUpdated.connect<&AutomationRecorder::parameterCallback>(*this);
-    }
-    else
-    {
-      dev.valueUpdated.connect<&AutomationRecorder::messageCallback>(*this);
-    }
+    dev.valueUpdated.connect<&AutomationRecorder::valueCallback>(*this);
 
     m_recordCallbackConnections.push_back(&dev);
 
     i++;
   }
 
+  m_receiveTimer.start();
+  if (m_settings.getSimplify())
+    m_simplifyTimer.start();
+
   return true;
 }
 
 void AutomationRecorder::stop()
 {
   // Stop all the recording machinery
-  auto msecs = context.time();
-  const auto curve_mode = m_recordingMode;
   for (const auto& dev : m_recordCallbackConnections)
   {
     if (dev)
     {
-      if (curve_mode == Curve::Settings::Mode::Parameter)
-      {
-        dev->valueUpdated.disconnect<&AutomationRecorder::parameterCallback>(*this);
-      }
-      else
-      {
-        dev->valueUpdated.disconnect<&AutomationRecorder::messageCallback>(*this);
-      }
+      dev->valueUpdated.disconnect<&AutomationRecorder::valueCallback>(*this);
     }
   }
   m_recordCallbackConnections.clear();
+  m_receiveTimer.stop();
+  m_simplifyTimer.stop();
+
+  // Record what came in since the last update
+  processReceivedValues();
+  auto msecs = context.time();
 
   QApplication::processEvents(QEventLoop::ExcludeUserInputEvents);
 
@@ -215,35 +216,63 @@ void AutomationRecorder::stop()
   }
 }
 
-void AutomationRecorder::messageCallback(const State::Address& addr, const ossia::value& val)
+void AutomationRecorder::simplifyRecords()
 {
-  using namespace std::chrono;
-  if (context.started())
-  {
-    val.apply(
-        RecordAutomationSubsequentCallbackVisitor<MessagePolicy>{*this, addr, context.time()});
-  }
-  else
-  {
-    firstMessageReceived();
-    context.start();
-    val.apply(RecordAutomationFirstCallbackVisitor{*this, addr});
-  }
+  if (!context.started())
+    return;
+
+  const auto ratio = m_settings.getSimplificationRatio();
+  auto simplify = [ratio](RecordData& rec) {
+    // Leave the points which just came in for the next pass
+    if (rec.segment.points().size() > rec.simplified + 64)
+      rec.simplified = rec.segment.simplify(ratio, rec.simplified);
+  };
+
+  for (auto& recorded : numeric_records)
+    simplify(recorded.second);
+  for (auto& recorded : vec2_records)
+    for (auto& rec : recorded.second)
+      simplify(rec);
+  for (auto& recorded : vec3_records)
+    for (auto& rec : recorded.second)
+      simplify(rec);
+  for (auto& recorded : vec4_records)
+    for (auto& rec : recorded.second)
+      simplify(rec);
 }
 
-void AutomationRecorder::parameterCallback(const State::Address& addr, const ossia::value& val)
+void AutomationRecorder::valueCallback(const State::Address& addr, const ossia::value& val)
 {
-  using namespace std::chrono;
-  if (context.started())
-  {
-    val.apply(
-        RecordAutomationSubsequentCallbackVisitor<ParameterPolicy>{*this, addr, context.time()});
-  }
-  else
+  // Called from the device's thread: the value is stamped as soon as it is
+  // received, so that GUI load does not affect the recorded timing.
+  m_received.enqueue({addr, val, RecordContext::clock::now()});
+}
+
+void AutomationRecorder::processReceivedValues()
+{
+  ReceivedValue v;
+  while (m_received.try_dequeue(v))
   {
-    firstMessageReceived();
-    context.start();
-    val.apply(RecordAutomationFirstCallbackVisitor{*this, addr});
+    if (context.started())
+    {
+      const auto t = context.time(v.time);
+      if (m_recordingMode == Curve::Settings::Mode::Parameter)
+      {
+        v.value.apply(
+            RecordAutomationSubsequentCallbackVisitor<ParameterPolicy>{*this, v.address, t});
+      }
+      else
+      {
+        v.value.apply(
+            RecordAutomationSubsequentCallbackVisitor<MessagePolicy>{*this, v.address, t});
+      }
+    }
+    else
+    {
+      firstMessageReceived();
+      context.start(v.time);
+      v.value.apply(RecordAutomationFirstCallbackVisitor{*this, v.address});
+    }
   }
 }
 
@@ -277,7 +306,7 @@ bool AutomationRecorder::finish(
   // Conversion of the piecewise to segments, and
   // serialization.
   if (simplify)
-    recorded.segment.simplify(simplifyRatio);
+    recorded.segment.simplify(simplifyRatio, recorded.simplified);
 
   // TODO if there is no remaining segment or an invalid segment, don't add it.
 
@@ -6,6 +6,10 @@
 
 #include <score/tools/std/HashMap.hpp>
 
+#include <QTimer>
+
+#include <concurrentqueue.h>
+
 #include <verdigris>
 namespace Curve
 {
@@ -41,13 +45,26 @@ public:
   void firstMessageReceived() W_SIGNAL(firstMessageReceived);
 
 private:
-  void messageCallback(const State::Address& addr, const ossia::value& val);
-  void parameterCallback(const State::Address& addr, const ossia::value& val);
+  struct ReceivedValue
+  {
+    State::Address address;
+    ossia::value value;
+    std::chrono::steady_clock::time_point time;
+  };
 
+  void valueCallback(const State::Address& addr, const ossia::value& val);
+  void processReceivedValues();
+  void simplifyRecords();
   bool finish(State::AddressAccessor addr, const RecordData& dat, const TimeVal& msecs, bool, int);
   const Curve::Settings::Model& m_settings;
   Curve::Settings::Mode m_recordingMode{};
   std::vector<QPointer<Device::DeviceInterface>> m_recordCallbackConnections;
+  QTimer m_simplifyTimer;
+
+  // Values are timestamped in the thread of the device which received them,
+  // and recorded in the GUI thread.
+  moodycamel::ConcurrentQueue<ReceivedValue> m_received;
+  QTimer m_receiveTimer;
 
   // TODO see this :
   // http://stackoverflow.com/questions/34596768/stdunordered-mapfind-using-a-type-different-than-the-key-type
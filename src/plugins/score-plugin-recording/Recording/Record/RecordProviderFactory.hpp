@@ -34,9 +34,9 @@ public:
   RecordContext& operator=(const RecordContext& other) = delete;
   RecordContext& operator=(RecordContext&& other) = delete;
 
-  void start()
+  void start(clock::time_point t = clock::now())
   {
-    firstValueTime = clock::now();
+    firstValueTime = t;
     startTimer();
   }
 
@@ -44,6 +44,13 @@ public:
 
   TimeVal time() const { return GetTimeDifference(firstValueTime); }
 
+  //! Time of t relative to the first recorded value
+  TimeVal time(clock::time_point t) const
+  {
+    using namespace std::chrono;
+    return TimeVal::fromMsecs(duration_cast<microseconds>(t - firstValueTime).count() / 1000.);
+  }
+
   double timeInDouble() const { return GetTimeDifferenceInDouble(firstValueTime); }
 
   const score::DocumentContext& context;
@@ -6,6 +6,7 @@
 #include "TextDialog.hpp"
 
 #include <Process/ProcessList.hpp>
+#include <Process/ProcessMimeSerialization.hpp>
 #include <Scenario/Application/ScenarioActions.hpp>
 #include <Scenario/Application/ScenarioApplicationPlugin.hpp>
 #include <Scenario/Application/ScenarioEditionSettings.hpp>
@@ -50,10 +51,42 @@
 #include <QKeySequence>
 #include <QMainWindow>
 #include <QMenu>
+#include <QMimeData>
 #include <qnamespace.h>
 
 namespace Scenario
 {
+/**
+ * The copied elements are put in the clipboard as raw UTF-8 JSON under the
+ * scenario MIME type, which avoids converting the whole selection to and
+ * from UTF-16 text. The text is also set so that other apps can read it.
+ */
+static void copyToClipboard(const JSONReader& r)
+{
+  // The plain text copy, for pasting in other applications, costs a
+  // conversion to UTF-16 and doubles the size of the clipboard:
+  // it is skipped for large selections.
+  static constexpr int max_text_size = 1024 * 1024;
+
+  auto mime = new QMimeData;
+  auto json = r.toByteArray();
+  if (json.size() <= max_text_size)
+    mime->setText(QString::fromUtf8(json));
+  mime->setData(score::mime::scenariodata(), std::move(json));
+  QApplication::clipboard()->setMimeData(mime);
+}
+
+static rapidjson::Document readClipboard()
+{
+  auto mime = QApplication::clipboard()->mimeData();
+  if (!mime)
+    return {};
+
+  if (mime->hasFormat(score::mime::scenariodata()))
+    return readJson(mime->data(score::mime::scenariodata()));
+
+  return readJson(mime->text().toUtf8());
+}
 
 ObjectMenuActions::ObjectMenuActions(ScenarioApplicationPlugin* parent)
     : m_parent{parent}, m_eventActions{parent}, m_cstrActions{parent}, m_stateActions{parent}
@@ -88,8 +121,7 @@ ObjectMenuActions::ObjectMenuActions(ScenarioApplicationPlugin* parent)
     if (r.empty())
       return;
 
-    auto clippy = QApplication::clipboard();
-    clippy->setText(r.toString());
+    copyToClipboard(r);
   });
 
   m_cutContent = new QAction{tr("Cut"), this};
@@ -100,8 +132,8 @@ ObjectMenuActions::ObjectMenuActions(ScenarioApplicationPlugin* parent)
     cutSelectedElementsToJson(r);
     if (r.empty())
       return;
-    auto clippy = QApplication::clipboard();
-    clippy->setText(r.toString());
+
+    copyToClipboard(r);
   });
 
   m_pasteElements = new QAction{tr("Paste elements"), this};
@@ -127,7 +159,7 @@ ObjectMenuActions::ObjectMenuActions(ScenarioApplicationPlugin* parent)
       sv_pt = sv.mapToScene(sv.boundingRect().center());
     }
     auto pt = pres->toScenarioPoint(sv_pt);
-    pasteElements(readJson(QApplication::clipboard()->text().toUtf8()), pt);
+    pasteElements(readClipboard(), pt);
   });
 
   m_pasteElementsAfter = new QAction{tr("Paste (after)"), this};
@@ -152,7 +184,7 @@ ObjectMenuActions::ObjectMenuActions(ScenarioApplicationPlugin* parent)
     }
     auto pt = pres->toScenarioPoint(sv_pt);
     pasteElementsAfter(
-        readJson(QApplication::clipboard()->text().toUtf8()),
+        readClipboard(),
         pt,
         pres->context().context.selectionStack.currentSelection());
   });
@@ -367,7 +399,7 @@ void ObjectMenuActions::setupContextMenu(Process::LayerContextMenuManager& ctxm)
         pasteElements->setShortcutContext(Qt::WidgetWithChildrenShortcut);
         connect(pasteElements, &QAction::triggered, [&, scenePoint]() {
           this->pasteElements(
-              readJson(QApplication::clipboard()->text().toUtf8()),
+              readClipboard(),
               scenario.toScenarioPoint(scenario.view().mapFromScene(scenePoint)));
         });
         menu.addAction(pasteElements);
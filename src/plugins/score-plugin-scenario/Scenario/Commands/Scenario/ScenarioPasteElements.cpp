@@ -58,86 +58,100 @@ ScenarioPasteElements::ScenarioPasteElements(
        state_ids]
       = ScenarioBeingCopied{obj, scenario, ctx};
 
-  // We set the new ids everywhere
+  // We set the new ids everywhere.
+  // The elements are looked up by id so that this stays linear in the
+  // number of pasted elements.
   {
-    int i = 0;
-    for (TimeSyncModel* timesync : timesyncs)
-    {
-      for (EventModel* event : events)
-      {
-        if (event->timeSync() == timesync->id())
-        {
-          event->changeTimeSync(timesync_ids[i]);
-        }
-      }
+    std::unordered_map<Id<TimeSyncModel>, std::size_t> timesync_index;
+    timesync_index.reserve(timesyncs.size());
+    for (std::size_t i = 0; i < timesyncs.size(); i++)
+      timesync_index[timesyncs[i]->id()] = i;
 
-      timesync->setId(timesync_ids[i]);
-      i++;
+    for (EventModel* event : events)
+    {
+      auto it = timesync_index.find(event->timeSync());
+      if (it != timesync_index.end())
+        event->changeTimeSync(timesync_ids[it->second]);
     }
+
+    for (std::size_t i = 0; i < timesyncs.size(); i++)
+      timesyncs[i]->setId(timesync_ids[i]);
   }
 
   {
-    int i = 0;
-    for (EventModel* event : events)
-    {
-      {
-        auto it = std::find_if(timesyncs.begin(), timesyncs.end(), [&](TimeSyncModel* tn) {
-          return tn->id() == event->timeSync();
-        });
-        SCORE_ASSERT(it != timesyncs.end());
-        auto timesync = *it;
-        timesync->removeEvent(event->id());
-        timesync->addEvent(event_ids[i]);
-      }
+    std::unordered_map<Id<TimeSyncModel>, TimeSyncModel*> timesync_by_id;
+    timesync_by_id.reserve(timesyncs.size());
+    for (TimeSyncModel* timesync : timesyncs)
+      timesync_by_id[timesync->id()] = timesync;
 
-      for (StateModel* state : states)
-      {
-        if (state->eventId() == event->id())
-        {
-          state->setEventId(event_ids[i]);
-        }
-      }
+    std::unordered_map<Id<EventModel>, std::size_t> event_index;
+    event_index.reserve(events.size());
+    for (std::size_t i = 0; i < events.size(); i++)
+    {
+      EventModel* event = events[i];
+      event_index[event->id()] = i;
+
+      auto it = timesync_by_id.find(event->timeSync());
+      SCORE_ASSERT(it != timesync_by_id.end());
+      auto timesync = it->second;
+      timesync->removeEvent(event->id());
+      timesync->addEvent(event_ids[i]);
+    }
 
-      event->setId(event_ids[i]);
-      i++;
+    for (StateModel* state : states)
+    {
+      auto it = event_index.find(state->eventId());
+      if (it != event_index.end())
+        state->setEventId(event_ids[it->second]);
     }
+
+    for (std::size_t i = 0; i < events.size(); i++)
+      events[i]->setId(event_ids[i]);
   }
 
   {
-    int i = 0;
-    for (StateModel* state : states)
-    {
-      {
-        auto it = std::find_if(events.begin(), events.end(), [&](EventModel* event) {
-          return event->id() == state->eventId();
-        });
-        SCORE_ASSERT(it != events.end());
-        auto event = *it;
-        event->removeState(state->id());
-        event->addState(state_ids[i]);
-      }
+    std::unordered_map<Id<EventModel>, EventModel*> event_by_id;
+    event_by_id.reserve(events.size());
+    for (EventModel* event : events)
+      event_by_id[event->id()] = event;
 
-      for (IntervalModel* interval : intervals)
-      {
-        if (interval->startState() == state->id())
-          interval->setStartState(state_ids[i]);
-        else if (interval->endState() == state->id())
-          interval->setEndState(state_ids[i]);
-      }
+    std::unordered_map<Id<StateModel>, std::size_t> state_index;
+    state_index.reserve(states.size());
+    for (std::size_t i = 0; i < states.size(); i++)
+    {
+      StateModel* state = states[i];
+      state_index[state->id()] = i;
+
+      auto it = event_by_id.find(state->eventId());
+      SCORE_ASSERT(it != event_by_id.end());
+      auto event = it->second;
+      event->removeState(state->id());
+      event->addState(state_ids[i]);
+    }
 
-      state->setId(state_ids[i]);
-      i++;
+    for (IntervalModel* interval : intervals)
+    {
+      auto start_it = state_index.find(interval->startState());
+      auto end_it = state_index.find(interval->endState());
+      if (start_it != state_index.end())
+        interval->setStartState(state_ids[start_it->second]);
+      if (end_it != state_index.end())
+        interval->setEndState(state_ids[end_it->second]);
     }
+
+    for (std::size_t i = 0; i < states.size(); i++)
+      states[i]->setId(state_ids[i]);
   }
 
   // Cables //
   {
-    std::unordered_map<Id<IntervalModel>, Id<IntervalModel>> id_map;
+    std::unordered_map<int32_t, int32_t> id_map;
+    id_map.reserve(intervals.size());
     {
       int i = 0;
       for (IntervalModel* interval : intervals)
       {
-        id_map[interval->id()] = interval_ids[i];
+        id_map[interval->id().val()] = interval_ids[i].val();
         i++;
       }
     }
@@ -156,14 +170,10 @@ ScenarioPasteElements::ScenarioPasteElements(
       int32_t source_itv_id = source_vec.front().id();
       int32_t sink_itv_id = sink_vec.front().id();
 
-      for (IntervalModel* interval : intervals)
-      {
-        auto id = interval->id().val();
-        if (id == source_itv_id)
-          source_itv_id = id_map.at(interval->id()).val();
-        if (id == sink_itv_id)
-          sink_itv_id = id_map.at(interval->id()).val();
-      }
+      if (auto it = id_map.find(source_itv_id); it != id_map.end())
+        source_itv_id = it->second;
+      if (auto it = id_map.find(sink_itv_id); it != id_map.end())
+        sink_itv_id = it->second;
       source_vec.front() = ObjectIdentifier{source_vec.front().objectName(), source_itv_id};
       sink_vec.front() = ObjectIdentifier{sink_vec.front().objectName(), sink_itv_id};
 
@@ -177,6 +187,11 @@ ScenarioPasteElements::ScenarioPasteElements(
   }
 
   {
+    std::unordered_map<Id<StateModel>, StateModel*> state_by_id;
+    state_by_id.reserve(states.size());
+    for (StateModel* state : states)
+      state_by_id[state->id()] = state;
+
     int i = 0;
     for (IntervalModel* interval : intervals)
     {
@@ -191,16 +206,14 @@ ScenarioPasteElements::ScenarioPasteElements(
 
       interval->setId(interval_ids[i]);
       {
-        auto start_state_id = ossia::find_if(
-            states, [&](auto state) { return state->id() == interval->startState(); });
-        if (start_state_id != states.end())
-          SetNextInterval(**start_state_id, *interval);
+        auto start_state = state_by_id.find(interval->startState());
+        if (start_state != state_by_id.end())
+          SetNextInterval(*start_state->second, *interval);
       }
       {
-        auto end_state_id = ossia::find_if(
-            states, [&](auto state) { return state->id() == interval->endState(); });
-        if (end_state_id != states.end())
-          SetPreviousInterval(**end_state_id, *interval);
+        auto end_state = state_by_id.find(interval->endState());
+        if (end_state != state_by_id.end())
+          SetPreviousInterval(*end_state->second, *interval);
       }
 
       const auto& fv = interval->fullView();
@@ -104,6 +104,7 @@ void EventModel::addState(const Id<StateModel>& ds)
   if (ossia::contains(m_states, ds))
     return;
   m_states.push_back(ds);
+  invalidateAdjacency(*this);
   statesChanged();
 }
 
@@ -113,6 +114,7 @@ void EventModel::removeState(const Id<StateModel>& ds)
   if (it != m_states.end())
   {
     m_states.erase(it);
+    invalidateAdjacency(*this);
     statesChanged();
   }
 }
@@ -120,6 +122,7 @@ void EventModel::removeState(const Id<StateModel>& ds)
 void EventModel::clearStates()
 {
   m_states.clear();
+  invalidateAdjacency(*this);
   statesChanged();
 }
 
@@ -6,12 +6,18 @@
 #include <Scenario/Document/TimeSync/TimeSyncModel.hpp>
 #include <Scenario/Process/Algorithms/Accessors.hpp>
 #include <Scenario/Process/Algorithms/ContainersAccessors.hpp>
+#include <Scenario/Process/Algorithms/IntervalAdjacency.hpp>
 #include <Scenario/Process/ScenarioInterface.hpp>
 
 #include <score/model/ModelMetadata.hpp>
 
 #include <ossia/detail/pod_vector.hpp>
 
+#include <ossia-qt/invoke.hpp>
+
+#include <QCoreApplication>
+#include <QRunnable>
+#include <QThreadPool>
 #include <QTimer>
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/breadth_first_search.hpp>
@@ -43,203 +49,386 @@ struct CycleDetector : public boost::dfs_visitor<>
 
 };
 */
-struct CycleDetector
+namespace
+{
+//! What the worker thread needs to look for cycles: no model object is accessed
+struct CycleSnapshot
+{
+  std::vector<Id<TimeSyncModel>> syncs;
+  std::vector<std::pair<int, int>> edges;
+};
+
+//! Pairs of time syncs (indices in the snapshot) that follow each other in a cycle
+using CycleLinks = std::vector<std::pair<int, int>>;
+
+struct CycleCollector
 {
-  const Scenario::ProcessModel& scenario;
-  bool& cycles;
+  CycleLinks& links;
 
-  ossia::small_vector<IntervalModel*, 4> this_path_itvs;
-  CycleDetector(const Scenario::ProcessModel& scenar, bool& cycles)
-      : scenario{scenar}, cycles{cycles}
+  template <typename Path, typename Graph_T>
+  void cycle(const Path& p, const Graph_T&)
   {
+    for (auto it = p.begin(), end = p.end(); it != end; ++it)
+    {
+      auto next = it + 1;
+      links.emplace_back(int(*it), int(next != end ? *next : *p.begin()));
+    }
   }
+};
 
-  bool allIntersectGraphal(std::vector<Id<IntervalModel>>& a, std::vector<Id<IntervalModel>>& b)
+CycleLinks findCycles(const CycleSnapshot& snapshot)
+{
+  using SnapshotGraph = boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS>;
+  SnapshotGraph g(snapshot.syncs.size());
+  for (auto [src, dst] : snapshot.edges)
+    boost::add_edge(src, dst, g);
+
+  CycleLinks links;
+  CycleCollector vis{links};
+  boost::tiernan_all_cycles(g, vis);
+
+  std::sort(links.begin(), links.end());
+  links.erase(std::unique(links.begin(), links.end()), links.end());
+  return links;
+}
+
+template <typename F>
+struct CycleCheckTask final : public QRunnable
+{
+  explicit CycleCheckTask(F&& f) : func{std::move(f)} { }
+  void run() override { func(); }
+  F func;
+};
+}
+
+TimenodeGraph::TimenodeGraph(const Scenario::ProcessModel& scenar, bool checkCycles)
+    : m_scenario{scenar}, m_checkCycles{checkCycles}
+{
+  rebuild();
+
+  // Many elements are added or removed at once when pasting or undoing:
+  // only check for cycles once the batch is done.
+  if (m_checkCycles)
   {
-    ossia::small_vector<Id<IntervalModel>, 4> intersect;
-    std::sort(a.begin(), a.end(), [](const auto& lhs, const auto& rhs) {
-      return lhs.val() < rhs.val();
-    });
-    std::sort(b.begin(), b.end(), [](const auto& lhs, const auto& rhs) {
-      return lhs.val() < rhs.val();
+    m_cycleCheck.setSingleShot(true);
+    m_cycleCheck.setInterval(8);
+    QObject::connect(&m_cycleCheck, &QTimer::timeout, &m_cycleCheck, [this] {
+      update();
+      if (std::exchange(m_cyclesOutdated, false))
+        this->checkCycles();
     });
-    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(intersect));
+  }
 
-    for (const auto& itv : intersect)
-    {
-      auto& m = scenario.interval(itv);
-      if (!m.graphal())
-      {
-        return false;
-      }
-    }
+  scenar.intervals.added.connect<&TimenodeGraph::intervalAdded>(this);
+  scenar.intervals.removed.connect<&TimenodeGraph::intervalRemoved>(this);
+  scenar.timeSyncs.added.connect<&TimenodeGraph::timeSyncAdded>(this);
+  scenar.timeSyncs.removed.connect<&TimenodeGraph::timeSyncRemoved>(this);
+}
 
-    for (const auto& itv : intersect)
-    {
-      auto& m = scenario.interval(itv);
-      this_path_itvs.push_back(&m);
-    }
+bool TimenodeGraph::hasCycles() const noexcept
+{
+  return m_cycles;
+}
 
-    return true;
+void TimenodeGraph::rebuild()
+{
+  m_dirty = false;
+  m_relinked.clear();
+  m_vertices.clear();
+  m_edges.clear();
+  m_graph.clear();
+
+  for (auto& tn : m_scenario.getTimeSyncs())
+  {
+    m_vertices[&tn] = boost::add_vertex(&tn, m_graph);
+  }
+
+  for (auto& cst : m_scenario.getIntervals())
+  {
+    m_edges[&cst] = boost::add_edge(
+                        m_vertices[&Scenario::startTimeSync(cst, m_scenario)],
+                        m_vertices[&Scenario::endTimeSync(cst, m_scenario)],
+                        &cst,
+                        m_graph)
+                        .first;
   }
+}
+
+void TimenodeGraph::update() const
+{
+  auto& self = const_cast<TimenodeGraph&>(*this);
+  if (!m_dirty && !m_relinked.empty())
+    self.relinkIntervals();
+  if (m_dirty)
+    self.rebuild();
+}
 
-  bool allIntervalsAreGraph(TimeSyncModel& a, TimeSyncModel& b)
+void TimenodeGraph::invalidate()
+{
+  m_dirty = true;
+  scheduleCycleCheck();
+}
+
+void TimenodeGraph::relinked(const TimeSyncModel& ts)
+{
+  if (m_dirty)
+    return;
+
+  // The same time sync is generally notified a few times in a row.
+  // Past a few dozen, e.g. when pasting, a rebuild is as cheap.
+  if (!m_relinked.empty() && m_relinked.back() == ts.id())
+    return;
+  if (m_relinked.size() >= 64)
   {
-    // auto prev_a = Scenario::previousIntervals(a, scenario);
-    auto next_a = Scenario::nextIntervals(a, scenario);
-    auto prev_b = Scenario::previousIntervals(b, scenario);
-    // auto next_b = Scenario::nextIntervals(b, scenario);
-
-    // auto prev_av = std::vector(prev_a.begin(), prev_a.end());
-    auto next_av = std::vector(next_a.begin(), next_a.end());
-
-    auto prev_bv = std::vector(prev_b.begin(), prev_b.end());
-    // auto next_bv = std::vector(next_b.begin(), next_b.end());
-    return allIntersectGraphal(next_av, prev_bv);
-    // else if(allIntersectGraphal(next_bv, prev_av))
-    //{
-    //  cycles = true;
-    //}
+    m_relinked.clear();
+    invalidate();
+    return;
   }
 
-  bool anyIntersectGraphal(std::vector<Id<IntervalModel>>& a, std::vector<Id<IntervalModel>>& b)
+  m_relinked.push_back(ts.id());
+
+  // The edges are moved in a batch, once the re-linking is done
+  if (m_checkCycles)
+    m_cycleCheck.start();
+}
+
+void TimenodeGraph::relinkIntervals()
+{
+  auto relinked = std::move(m_relinked);
+  m_relinked.clear();
+
+  // Only the intervals which now start or end at one of these time syncs
+  // can have moved.
+  for (const auto& ts_id : relinked)
   {
-    ossia::small_vector<Id<IntervalModel>, 4> intersect;
-    std::sort(a.begin(), a.end(), [](const auto& lhs, const auto& rhs) {
-      return lhs.val() < rhs.val();
-    });
-    std::sort(b.begin(), b.end(), [](const auto& lhs, const auto& rhs) {
-      return lhs.val() < rhs.val();
-    });
-    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(intersect));
+    auto ts = m_scenario.findTimeSync(ts_id);
+    if (!ts)
+      continue;
 
-    bool ok = false;
-    for (const auto& itv : intersect)
+    for (const auto& ev_id : ts->events())
     {
-      auto& m = scenario.interval(itv);
-      if (m.graphal())
-      {
-        ok = true;
-      }
-    }
+      auto ev = m_scenario.findEvent(ev_id);
+      if (!ev)
+        continue;
 
-    if(ok)
-    {
-      for (const auto& itv : intersect)
+      for (const auto& st_id : ev->states())
       {
-        auto& m = scenario.interval(itv);
-        this_path_itvs.push_back(&m);
+        auto st = m_scenario.findState(st_id);
+        if (!st)
+          continue;
+
+        if (const auto& prev = st->previousInterval())
+          if (auto itv = m_scenario.findInterval(*prev))
+            relinkInterval(*itv);
+        if (const auto& next = st->nextInterval())
+          if (auto itv = m_scenario.findInterval(*next))
+            relinkInterval(*itv);
+
+        if (m_dirty)
+          return;
       }
     }
-
-    return ok;
   }
-  bool anyIntervalIsGraph(TimeSyncModel& a, TimeSyncModel& b)
+}
+
+void TimenodeGraph::relinkInterval(const IntervalModel& itv)
+{
+  // Intervals not yet in the graph get their edge in intervalAdded
+  auto edge = m_edges.find(&itv);
+  if (edge == m_edges.end())
+    return;
+
+  auto vertex = [&](const Id<StateModel>& st_id) -> const Graph::vertex_descriptor* {
+    auto st = m_scenario.findState(st_id);
+    auto ev = st ? m_scenario.findEvent(st->eventId()) : nullptr;
+    auto ts = ev ? m_scenario.findTimeSync(ev->timeSync()) : nullptr;
+    auto it = m_vertices.find(ts);
+    return it != m_vertices.end() ? &it->second : nullptr;
+  };
+
+  auto src = vertex(itv.startState());
+  auto dst = vertex(itv.endState());
+  if (!src || !dst)
   {
-    // auto prev_a = Scenario::previousIntervals(a, scenario);
-    auto next_a = Scenario::nextIntervals(a, scenario);
-    auto prev_b = Scenario::previousIntervals(b, scenario);
-    // auto next_b = Scenario::nextIntervals(b, scenario);
-
-    // auto prev_av = std::vector(prev_a.begin(), prev_a.end());
-    auto next_av = std::vector(next_a.begin(), next_a.end());
-
-    auto prev_bv = std::vector(prev_b.begin(), prev_b.end());
-    // auto next_bv = std::vector(next_b.begin(), next_b.end());
-    return anyIntersectGraphal(next_av, prev_bv);
-    // else if(allIntersectGraphal(next_bv, prev_av))
-    //{
-    //  cycles = true;
-    //}
+    m_dirty = true;
+    return;
   }
 
-  template <typename Path>
-  void cycle(const Path& p, const Scenario::Graph& g)
-  {
-    this_path_itvs.clear();
-    bool has_non_graphal = false;
-    for (auto it = p.begin(), end = p.end(); it != end; ++it)
-    {
-      TimeSyncModel* this_ts = (TimeSyncModel*)g[*it];
-      TimeSyncModel* next_ts = nullptr;
-      auto next = it + 1;
-      if (next != p.end())
-      {
-        next_ts = (TimeSyncModel*)g[*next];
-      }
-      else
-      {
-        next_ts = (TimeSyncModel*)g[*p.begin()];
-      }
+  if (boost::source(edge->second, m_graph) == *src
+      && boost::target(edge->second, m_graph) == *dst)
+    return;
 
-      if (!anyIntervalIsGraph(*this_ts, *next_ts))
-        has_non_graphal = true;
-      //if (!allIntervalsAreGraph(*this_ts, *next_ts))
-      //  has_non_graphal = true;
-    }
+  auto ptr = const_cast<IntervalModel*>(&itv);
+  boost::remove_edge(edge->second, m_graph);
+  edge.value() = boost::add_edge(*src, *dst, ptr, m_graph).first;
 
-    if (!has_non_graphal)
-    {
-      cycles = true;
-      for (auto itv : this_path_itvs)
-        itv->consistency.setValid(false);
-    }
+  if (itv.graphal() || m_cycles)
+    scheduleCycleCheck();
+}
+
+void TimenodeGraph::scheduleCycleCheck()
+{
+  if (m_checkCycles)
+  {
+    m_cyclesOutdated = true;
+    m_cycleCheck.start();
   }
-};
+}
 
-TimenodeGraph::TimenodeGraph(const Scenario::ProcessModel& scenar) : m_scenario{scenar}
+TimenodeGraph::~TimenodeGraph()
 {
-  for (auto& tn : scenar.getTimeSyncs())
+  // Results of a check still running are dropped
+  *m_alive = false;
+}
+
+void TimenodeGraph::checkCycles()
+{
+  const auto generation = ++m_cycleGeneration;
+
+  // A cycle can only be made of graphal intervals, thus the search
+  // is done on the sub-graph that they form, which is generally tiny.
+  CycleSnapshot snapshot;
+  score::hash_map<const Scenario::TimeSyncModel*, int> indices;
+  auto index = [&](const Scenario::TimeSyncModel* ts) {
+    auto it = indices.find(ts);
+    if (it != indices.end())
+      return it->second;
+
+    const int idx = int(snapshot.syncs.size());
+    snapshot.syncs.push_back(ts->id());
+    indices[ts] = idx;
+    return idx;
+  };
+
+  for (auto& cst : m_scenario.getIntervals())
   {
-    m_vertices[&tn] = boost::add_vertex(&tn, m_graph);
+    if (!cst.graphal())
+      continue;
+
+    auto it = m_edges.find(&cst);
+    if (it == m_edges.end())
+      continue;
+
+    auto src = m_graph[boost::source(it->second, m_graph)];
+    auto dst = m_graph[boost::target(it->second, m_graph)];
+    snapshot.edges.emplace_back(index(src), index(dst));
   }
 
-  for (auto& cst : scenar.getIntervals())
+  if (snapshot.edges.empty())
   {
-    m_edges[&cst] = boost::add_edge(
-                        m_vertices[&Scenario::startTimeSync(cst, scenar)],
-                        m_vertices[&Scenario::endTimeSync(cst, scenar)],
-                        &cst,
-                        m_graph)
-                        .first;
+    applyCycles(generation, {}, {});
+    return;
   }
 
-  scenar.intervals.added.connect<&TimenodeGraph::intervalsChanged>(this);
-  scenar.intervals.removed.connect<&TimenodeGraph::intervalsChanged>(this);
-  scenar.timeSyncs.added.connect<&TimenodeGraph::timeSyncsChanged>(this);
-  scenar.timeSyncs.removed.connect<&TimenodeGraph::timeSyncsChanged>(this);
+  // The enumeration of the cycles is exponential in the worst case:
+  // it runs on a worker thread and the result is applied when it comes back.
+  auto task = [this, alive = m_alive, generation, snapshot = std::move(snapshot)]() mutable {
+    auto links = findCycles(snapshot);
+    ossia::qt::run_async(
+        QCoreApplication::instance(),
+        [this, alive, generation, syncs = std::move(snapshot.syncs), links = std::move(links)] {
+          if (*alive)
+            applyCycles(generation, syncs, links);
+        });
+  };
+  QThreadPool::globalInstance()->start(new CycleCheckTask<decltype(task)>{std::move(task)});
 }
 
-bool TimenodeGraph::hasCycles() const noexcept
+void TimenodeGraph::applyCycles(
+    uint64_t generation,
+    const std::vector<Id<TimeSyncModel>>& syncs,
+    const std::vector<std::pair<int, int>>& links)
 {
-  return m_cycles;
+  // A more recent check has been started since
+  if (generation != m_cycleGeneration)
+    return;
+
+  m_cycles = !links.empty();
+  for (auto& cst : m_scenario.getIntervals())
+    cst.consistency.setValid(true);
+
+  const auto& adjacency = m_scenario.adjacency();
+  for (auto [src, dst] : links)
+  {
+    auto a = m_scenario.findTimeSync(syncs[src]);
+    auto b = m_scenario.findTimeSync(syncs[dst]);
+    if (!a || !b)
+      continue;
+
+    // Every interval going from a to b is part of the cycle
+    const auto& prev_b = adjacency.previousIntervals(*b);
+    for (IntervalModel* itv : adjacency.nextIntervals(*a))
+    {
+      if (ossia::contains(prev_b, itv))
+        itv->consistency.setValid(false);
+    }
+  }
 }
 
-void TimenodeGraph::recompute()
+void TimenodeGraph::intervalAdded(const IntervalModel& itv)
 {
-  m_cycles = false;
-  m_vertices.clear();
-  m_edges.clear();
-  m_graph.clear();
-
-  for (auto& tn : m_scenario.getTimeSyncs())
+  auto src = m_vertices.find(&Scenario::startTimeSync(itv, m_scenario));
+  auto dst = m_vertices.find(&Scenario::endTimeSync(itv, m_scenario));
+  if (src != m_vertices.end() && dst != m_vertices.end())
   {
-    m_vertices[&tn] = boost::add_vertex(&tn, m_graph);
+    auto ptr = const_cast<IntervalModel*>(&itv);
+    m_edges[ptr] = boost::add_edge(src->second, dst->second, ptr, m_graph).first;
+  }
+  else
+  {
+    m_dirty = true;
   }
 
-  for (auto& cst : m_scenario.getIntervals())
+  // Only graphal intervals can close a cycle
+  if (itv.graphal() || m_dirty)
+    scheduleCycleCheck();
+}
+
+void TimenodeGraph::intervalRemoved(const IntervalModel& itv)
+{
+  auto it = m_edges.find(&itv);
+  if (it != m_edges.end())
   {
-    cst.consistency.setValid(true);
-    m_edges[&cst] = boost::add_edge(
-                        m_vertices[&Scenario::startTimeSync(cst, m_scenario)],
-                        m_vertices[&Scenario::endTimeSync(cst, m_scenario)],
-                        &cst,
-                        m_graph)
-                        .first;
+    boost::remove_edge(it->second, m_graph);
+    m_edges.erase(it);
   }
 
-  CycleDetector vis{m_scenario, m_cycles};
-  tiernan_all_cycles(m_graph, vis);
+  // Removing an interval can only break existing cycles,
+  // or the ones that a check in progress may find
+  if (m_cycles || itv.graphal())
+    scheduleCycleCheck();
+}
+
+void TimenodeGraph::timeSyncAdded(const TimeSyncModel& ts)
+{
+  m_vertices[&ts] = boost::add_vertex(const_cast<TimeSyncModel*>(&ts), m_graph);
+}
+
+void TimenodeGraph::timeSyncRemoved(const TimeSyncModel& ts)
+{
+  // The intervals are generally removed before their time syncs.
+  // If some are still there, their events were moved to another time sync,
+  // e.g. when merging: their edges are moved first, and if some remain
+  // the graph has to be rebuilt.
+  if (!m_dirty && !m_relinked.empty())
+    relinkIntervals();
+
+  auto it = m_vertices.find(&ts);
+  if (it == m_vertices.end())
+    return;
+
+  const auto v = it->second;
+  const bool had_edges
+      = boost::out_degree(v, m_graph) > 0 || boost::in_degree(v, m_graph) > 0;
+
+  boost::clear_vertex(v, m_graph);
+  boost::remove_vertex(v, m_graph);
+  m_vertices.erase(it);
+
+  if (had_edges)
+    invalidate();
+  else if (m_cycles)
+    scheduleCycleCheck();
 }
 
 void TimenodeGraph::writeGraphviz()
@@ -280,16 +469,6 @@ TimenodeGraphComponents TimenodeGraph::components()
   return {m_scenario, comps};
 }
 */
-void TimenodeGraph::intervalsChanged(const IntervalModel&)
-{
-  QTimer::singleShot(8, &m_scenario, [this] { recompute(); });
-}
-
-void TimenodeGraph::timeSyncsChanged(const TimeSyncModel&)
-{
-  QTimer::singleShot(8, &m_scenario, [this] { recompute(); });
-}
-
 bool TimenodeGraphComponents::isInMain(const EventModel& c) const
 {
   return isInMain(Scenario::parentTimeSync(c, parentScenario(c)));
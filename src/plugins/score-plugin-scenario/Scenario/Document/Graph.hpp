@@ -1,6 +1,9 @@
 #pragma once
+#include <score/model/Identifier.hpp>
 #include <score/tools/std/HashMap.hpp>
 
+#include <QTimer>
+
 #include <boost/graph/adjacency_list.hpp>
 #include <boost/graph/directed_graph.hpp>
 
@@ -32,8 +35,13 @@ using Graph = boost::adjacency_list<
  * @brief A directed graph of all the TimeSync%s in a ScenarioInterface.
  *
  * The vertices are the TimeSync%s, the edges are the IntervalModel%s.
- * The graph is built upon construction.
+ * The graph is built upon construction and then kept in sync
+ * with the additions and removals in the scenario ; the edges of re-linked
+ * intervals are moved on the next access.
  *
+ * If checkCycles is set, cycle detection is deferred, coalesced, and runs on
+ * a snapshot in a worker thread: this is only meant for the instance owned
+ * by the scenario model, used by the editor.
  */
 
 struct SCORE_PLUGIN_SCENARIO_EXPORT TimenodeGraphConnectedComponent
@@ -57,11 +65,27 @@ struct SCORE_PLUGIN_SCENARIO_EXPORT TimenodeGraphComponents
 struct SCORE_PLUGIN_SCENARIO_EXPORT TimenodeGraph
     : public Nano::Observer
 {
-  TimenodeGraph(const Scenario::ProcessModel& scenar);
+  explicit TimenodeGraph(const Scenario::ProcessModel& scenar, bool checkCycles = false);
+  ~TimenodeGraph();
+
+  const Graph& graph() const
+  {
+    update();
+    return m_graph;
+  }
+  const auto& edges() const
+  {
+    update();
+    return m_edges;
+  }
+  const auto& vertices() const
+  {
+    update();
+    return m_vertices;
+  }
 
-  const Graph& graph() const { return m_graph; }
-  const auto& edges() const { return m_edges; }
-  const auto& vertices() const { return m_vertices; }
+  //! To be called when the intervals starting or ending at ts change
+  void relinked(const TimeSyncModel& ts);
 
   bool hasCycles() const noexcept;
   //! Writes graphviz output on stdout
@@ -70,13 +94,34 @@ struct SCORE_PLUGIN_SCENARIO_EXPORT TimenodeGraph
   TimenodeGraphComponents components();
 
 private:
-  void intervalsChanged(const IntervalModel&);
-  void timeSyncsChanged(const TimeSyncModel&);
-  void recompute();
+  void intervalAdded(const IntervalModel&);
+  void intervalRemoved(const IntervalModel&);
+  void timeSyncAdded(const TimeSyncModel&);
+  void timeSyncRemoved(const TimeSyncModel&);
+  void rebuild();
+  void update() const;
+  void invalidate();
+  void relinkIntervals();
+  void relinkInterval(const IntervalModel& itv);
+  void scheduleCycleCheck();
+  void checkCycles();
+  void applyCycles(
+      uint64_t generation,
+      const std::vector<Id<TimeSyncModel>>& syncs,
+      const std::vector<std::pair<int, int>>& links);
 
   const Scenario::ProcessModel& m_scenario;
   Graph m_graph;
+  QTimer m_cycleCheck;
+  std::shared_ptr<bool> m_alive{std::make_shared<bool>(true)};
+  uint64_t m_cycleGeneration{};
+  bool m_checkCycles{};
   bool m_cycles{};
+  bool m_cyclesOutdated{};
+  bool m_dirty{};
+
+  //! Time syncs whose intervals may have changed endpoints
+  std::vector<Id<TimeSyncModel>> m_relinked;
 
   score::hash_map<const Scenario::TimeSyncModel*, Graph::vertex_descriptor> m_vertices;
   score::hash_map<const Scenario::IntervalModel*, Graph::edge_descriptor> m_edges;
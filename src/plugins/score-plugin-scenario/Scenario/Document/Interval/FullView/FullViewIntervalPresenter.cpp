@@ -29,6 +29,7 @@
 #include <Scenario/Document/Interval/SlotHeader.hpp>
 #include <Scenario/Document/ScenarioDocument/MusicalGrid.hpp>
 #include <Scenario/Document/ScenarioDocument/ScenarioDocumentPresenter.hpp>
+#include <Scenario/Process/Algorithms/TimeSyncDates.hpp>
 #include <Scenario/Process/ScenarioModel.hpp>
 #include <Scenario/Settings/ScenarioSettingsModel.hpp>
 
@@ -548,16 +549,8 @@ FullViewIntervalPresenter::magneticPosition(const QObject* o, const TimeVal t) c
   {
     if (auto scenario = qobject_cast<Scenario::ProcessModel*>(given_ts->parent()))
     {
-      for (auto& ts : scenario->timeSyncs)
-      {
-        if (given_ts == &ts)
-          continue;
-
-        if (std::abs(ts.date().impl - t.impl) < std::abs(closestTimeSyncT.impl - t.impl))
-        {
-          closestTimeSyncT = ts.date();
-        }
-      }
+      if (auto closest = scenario->timeSyncDates().closest(t, given_ts))
+        closestTimeSyncT = *closest;
       double delta = std::abs((closestTimeSyncT - t).toPixels(m_zoomRatio));
       if (delta < 10)
       {
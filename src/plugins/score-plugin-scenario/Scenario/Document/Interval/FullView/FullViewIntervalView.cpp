@@ -46,7 +46,7 @@ void FullViewIntervalView::drawDashedPath(
   const qreal gui_w = m_guiWidth;
   const qreal play_w = playWidth();
 
-  auto& pixmaps = intervalPixmaps(skin);
+  auto& pixmaps = intervalPixmaps(skin, p.device()->devicePixelRatioF());
   auto& dash_pixmap = !this->m_selected ? pixmaps.dashed : pixmaps.dashedSelected;
 
   // Paths
@@ -83,7 +83,7 @@ void FullViewIntervalView::drawPlayDashedPath(
   double actual_min = std::max(min_w, visibleRect.left());
   double actual_max = std::min(infinite() ? gui_w : max_w, visibleRect.right());
 
-  auto& pixmaps = intervalPixmaps(skin);
+  auto& pixmaps = intervalPixmaps(skin, p.device()->devicePixelRatioF());
 
   // waiting
   const int idx = m_waiting ? skin.skin.PulseIndex : 0;
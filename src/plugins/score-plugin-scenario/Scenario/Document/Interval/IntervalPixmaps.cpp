@@ -1,68 +1,64 @@
 #include <Scenario/Document/Interval/IntervalPixmaps.hpp>
 
+#include <cmath>
+
 namespace Scenario
 {
 
-void IntervalPixmaps::update(const Process::Style& style)
+namespace
 {
-  auto& dashPen = style.IntervalDashPen(style.IntervalBase());
-  auto& dashSelectedPen = style.IntervalDashPen(style.IntervalSelected());
-  if (oldBase == dashPen.color() && oldSelected == dashSelectedPen.color())
-    return;
-
-  static constexpr double dash_width = 18.;
-  {
-    const auto pen_width = dashPen.widthF();
+// Each pixmap is a strip of dash_count dashes so that painting a long
+// interval only needs a handful of blits instead of one per dash.
+static constexpr int dash_width = 18;
+static constexpr int dash_count = 32;
 
-    QImage image(dash_width, pen_width, QImage::Format_ARGB32_Premultiplied);
-    image.fill(Qt::transparent);
-    QPainter p;
-    p.begin(&image);
-    p.setPen(dashPen);
-    p.drawLine(QPointF{0, pen_width / 2.}, QPointF{dash_width, pen_width / 2.});
-    p.end();
+QPixmap dashStrip(const QPen& pen, qreal pen_width, qreal ratio)
+{
+  const qreal w = dash_width * dash_count;
+  QImage image(
+      std::ceil(w * ratio),
+      std::ceil(pen_width * ratio),
+      QImage::Format_ARGB32_Premultiplied);
+  image.setDevicePixelRatio(ratio);
+  image.fill(Qt::transparent);
 
-    dashed = QPixmap::fromImage(image);
-  }
+  QPainter p;
+  p.begin(&image);
+  p.setPen(pen);
+  p.drawLine(QPointF{0, pen_width / 2.}, QPointF{w, pen_width / 2.});
+  p.end();
 
-  {
-    const auto pen_width = dashSelectedPen.widthF();
+  return QPixmap::fromImage(image);
+}
+}
 
-    QImage image(dash_width, pen_width, QImage::Format_ARGB32_Premultiplied);
-    image.fill(Qt::transparent);
-    QPainter p;
-    p.begin(&image);
-    p.setPen(dashSelectedPen);
-    p.drawLine(QPointF{0, pen_width / 2.}, QPointF{dash_width, pen_width / 2.});
-    p.end();
+void IntervalPixmaps::update(const Process::Style& style, qreal ratio)
+{
+  auto& dashPen = style.IntervalDashPen(style.IntervalBase());
+  auto& dashSelectedPen = style.IntervalDashPen(style.IntervalSelected());
+  if (oldBase == dashPen.color() && oldSelected == dashSelectedPen.color()
+      && oldRatio == ratio)
+    return;
 
-    dashedSelected = QPixmap::fromImage(image);
-  }
+  dashed = dashStrip(dashPen, dashPen.widthF(), ratio);
+  dashedSelected = dashStrip(dashSelectedPen, dashSelectedPen.widthF(), ratio);
 
   {
     auto dashPlayPen = style.IntervalDashPen(style.IntervalPlayDashFill());
     QColor pulse_base = style.skin.Pulse1.color();
+    const auto pen_width = dashSelectedPen.widthF();
     for (int i = 0; i < 25; i++)
     {
       float alpha = 0.5 + 0.02 * i;
       pulse_base.setAlphaF(alpha);
       dashPlayPen.setColor(pulse_base);
 
-      const auto pen_width = dashSelectedPen.widthF();
-
-      QImage image(dash_width, pen_width, QImage::Format_ARGB32_Premultiplied);
-      image.fill(Qt::transparent);
-      QPainter p;
-      p.begin(&image);
-      p.setPen(dashPlayPen);
-      p.drawLine(QPointF{0, pen_width / 2.}, QPointF{dash_width, pen_width / 2.});
-      p.end();
-
-      playDashed[i] = QPixmap::fromImage(image);
+      playDashed[i] = dashStrip(dashPlayPen, pen_width, ratio);
     }
   }
   oldBase = dashPen.color();
   oldSelected = dashSelectedPen.color();
+  oldRatio = ratio;
 }
 
 void IntervalPixmaps::drawDashes(
@@ -74,20 +70,25 @@ void IntervalPixmaps::drawDashes(
 {
   from = std::max(from, visibleRect.left());
   to = std::min(to, visibleRect.right());
-  const qreal w = pixmap.width();
+  const qreal ratio = pixmap.devicePixelRatioF();
+  const qreal w = pixmap.width() / ratio;
   const qreal h = -2.;
   for (; from < to - w; from += w)
   {
-    p.drawPixmap(from, h, pixmap);
+    p.drawPixmap(QPointF{from, h}, pixmap);
   }
 
-  p.drawPixmap(QRectF{from, h, -1, -1}, pixmap, QRectF{0, 0, to - from, h});
+  if (from < to)
+    p.drawPixmap(
+        QRectF{from, h, to - from, pixmap.height() / ratio},
+        pixmap,
+        QRectF{0, 0, (to - from) * ratio, qreal(pixmap.height())});
 }
 
-IntervalPixmaps& intervalPixmaps(const Process::Style& style)
+IntervalPixmaps& intervalPixmaps(const Process::Style& style, qreal ratio)
 {
   static IntervalPixmaps pixmaps;
-  pixmaps.update(style);
+  pixmaps.update(style, ratio);
   return pixmaps;
 }
 }
@@ -12,9 +12,10 @@ namespace Scenario
 
 struct IntervalPixmaps
 {
-  void update(const Process::Style& style);
+  void update(const Process::Style& style, qreal ratio);
 
   QColor oldBase, oldSelected;
+  qreal oldRatio{};
   QPixmap dashed;
   QPixmap dashedSelected;
   std::array<QPixmap, 25> playDashed;
@@ -23,5 +24,6 @@ struct IntervalPixmaps
   drawDashes(qreal from, qreal to, QPainter& p, const QRectF& visibleRect, const QPixmap& pixmap);
 };
 
-IntervalPixmaps& intervalPixmaps(const Process::Style& style);
+//! Shared dash pixmaps, rendered for the given device pixel ratio
+IntervalPixmaps& intervalPixmaps(const Process::Style& style, qreal ratio = 1.);
 }
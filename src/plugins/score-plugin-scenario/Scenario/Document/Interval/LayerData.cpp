@@ -2,6 +2,7 @@
 #include <Process/LayerView.hpp>
 #include <Process/Process.hpp>
 #include <Scenario/Document/Interval/LayerData.hpp>
+#include <Scenario/Document/ScenarioDocument/ScenarioDocumentViewConstants.hpp>
 
 #include <score/graphics/RectItem.hpp>
 #include <score/tools/Debug.hpp>
@@ -339,9 +340,9 @@ void LayerRectItem::setSize(const QSizeF& r)
     m_size = r;
     sizeChanged(m_size);
 
-    if (r.width() <= 2 && isVisible())
+    if (r.width() < IntervalLodMinWidth && isVisible())
       setVisible(false);
-    else if (r.width() > 2 && !isVisible())
+    else if (r.width() >= IntervalLodMinWidth && !isVisible())
       setVisible(true);
   }
 }
@@ -354,9 +355,9 @@ void LayerRectItem::setWidth(qreal w)
     m_size.setWidth(w);
     sizeChanged(m_size);
 
-    if (w <= 2 && isVisible())
+    if (w < IntervalLodMinWidth && isVisible())
       setVisible(false);
-    else if (w > 2 && !isVisible())
+    else if (w >= IntervalLodMinWidth && !isVisible())
       setVisible(true);
   }
 }
@@ -856,6 +856,7 @@ void TemporalIntervalPresenter::updateScaling()
 
 void TemporalIntervalPresenter::on_zoomRatioChanged(ZoomRatio ratio)
 {
+  m_layersZoomPending = false;
   IntervalPresenter::on_zoomRatioChanged(ratio);
   auto def_width = m_model.duration.defaultDuration().toPixels(ratio);
 
@@ -876,6 +877,26 @@ void TemporalIntervalPresenter::on_zoomRatioChanged(ZoomRatio ratio)
   updateProcessesShape();
 }
 
+void TemporalIntervalPresenter::on_offscreenZoomRatioChanged(ZoomRatio ratio)
+{
+  // The layers are by far the most costly part of a zoom change and are not
+  // visible anyways: only the interval line and header are kept in sync.
+  m_zoomRatio = ratio;
+  m_layersZoomPending = true;
+
+  const auto w = m_model.duration.defaultDuration().toPixels(ratio);
+  m_view->setDefaultWidth(w);
+  m_view->updateCounterPos();
+  m_header->setWidth(w - 20.);
+  IntervalPresenter::updateScaling();
+}
+
+void TemporalIntervalPresenter::updateLayersZoom()
+{
+  if (m_layersZoomPending)
+    on_zoomRatioChanged(m_zoomRatio);
+}
+
 void TemporalIntervalPresenter::changeRackState()
 {
   ((IntervalModel&)m_model)
@@ -41,6 +41,11 @@ public:
 
   void on_zoomRatioChanged(ZoomRatio val) override;
 
+  //! Only rescales the interval itself: the layers are updated in updateLayersZoom
+  void on_offscreenZoomRatioChanged(ZoomRatio val);
+  void updateLayersZoom();
+  bool layersZoomPending() const noexcept { return m_layersZoomPending; }
+
   void changeRackState();
   void selectedSlot(int) const override;
   TemporalIntervalView* view() const;
@@ -83,5 +88,6 @@ private:
   void setHeaderWidth(const SlotPresenter& slot, double w);
 
   bool m_handles{true};
+  bool m_layersZoomPending{false};
 };
 }
@@ -134,7 +134,7 @@ void TemporalIntervalView::drawDashedPath(
   const qreal def_w = defaultWidth();
   const qreal play_w = playWidth();
 
-  auto& pixmaps = intervalPixmaps(skin);
+  auto& pixmaps = intervalPixmaps(skin, p.device()->devicePixelRatioF());
   auto& dash_pixmap = !this->m_selected ? pixmaps.dashed : pixmaps.dashedSelected;
 
   // Paths
@@ -170,7 +170,7 @@ void TemporalIntervalView::drawPlayDashedPath(
   double actual_min = std::max(min_w, visibleRect.left());
   double actual_max = std::min(infinite() ? def_w : max_w, visibleRect.right());
 
-  auto& pixmaps = intervalPixmaps(skin);
+  auto& pixmaps = intervalPixmaps(skin, p.device()->devicePixelRatioF());
 
   // waiting
   const int idx = m_waiting ? skin.skin.PulseIndex : 0;
@@ -250,6 +250,19 @@ void TemporalIntervalView::paint(QPainter* p, const QStyleOptionGraphicsItem* so
   painter.setRenderHint(QPainter::Antialiasing, false);
   auto& skin = Process::Style::instance();
 
+  // Level of detail: at wide zoom levels the rack background, dashes and
+  // play paths are indistinguishable, a single line is enough.
+  // The dashes of a flexible interval may still extend further.
+  const bool narrow = m_defaultWidth < IntervalLodMinWidth && !m_infinite
+                      && m_maxWidth < IntervalLodMinWidth;
+  if (narrow && !m_execPing.running())
+  {
+    const auto& brush = m_playWidth > 0. ? skin.IntervalPlayFill() : this->intervalColor(skin);
+    painter.setPen(skin.IntervalSolidPen(brush));
+    painter.drawLine(QPointF{0., 0.}, QPointF{std::max(m_defaultWidth, 1.), 0.});
+    return;
+  }
+
   QRectF visibleRect = QRectF{itemDrawableTopLeft, itemDrawableBottomRight};
   auto& c = presenter().model();
   if (c.smallViewVisible())
@@ -5,6 +5,8 @@
 
 #include <QLineF>
 
+#include <algorithm>
+
 #include <wobjectimpl.h>
 W_OBJECT_IMPL(Scenario::MusicalGrid)
 
@@ -16,30 +18,11 @@ namespace
 ossia::bar_time timeToMetrics(MusicalGrid& grid, TimeVal x0_time)
 {
   auto& measures = *grid.m_measures;
-  // Compute the amount of bars before so that we can index them
+  // The amount of bars before the last signature change is indexed
   ossia::bar_time start{};
   auto last_before = ossia::last_before(measures, x0_time);
+  start.bars = grid.m_barIndex[std::distance(measures.begin(), last_before)];
 
-  if (last_before != measures.begin())
-  {
-    int64_t prev_bar_date = 0;
-    ossia::time_signature prev_sig = measures.begin()->second;
-
-    auto it = measures.begin() + 1;
-    for (; it <= last_before; ++it)
-    {
-      const auto sig_upper = prev_sig.upper;
-      const auto sig_lower = prev_sig.lower;
-      int64_t this_bar_date = it->first.impl;
-      int32_t quarters = (this_bar_date - prev_bar_date) / ossia::quarter_duration<int64_t>;
-      int32_t bars = quarters / (4. * double(sig_upper) / sig_lower);
-
-      start.bars += bars + 1;
-
-      prev_bar_date = this_bar_date;
-      prev_sig = it->second;
-    }
-  }
   {
     const auto sig_upper = last_before->second.upper;
     const auto sig_lower = last_before->second.lower;
@@ -285,6 +268,44 @@ bars * (4. * double(sig_upper) / sig_lower);
 */
 }
 
+void MusicalGrid::setMeasures(const TimeSignatureMap& m)
+{
+  m_measures = &m;
+
+  auto same_signature = [](const auto& lhs, const auto& rhs) {
+    return lhs.first == rhs.first && lhs.second.upper == rhs.second.upper
+           && lhs.second.lower == rhs.second.lower;
+  };
+  if (!m_barIndex.empty() && m.size() == m_indexedMeasures.size()
+      && std::equal(m.begin(), m.end(), m_indexedMeasures.begin(), same_signature))
+    return;
+
+  m_indexedMeasures = m;
+  m_barIndex.clear();
+  m_barIndex.reserve(m.size());
+  if (m.empty())
+    return;
+
+  int32_t bars_so_far = 0;
+  int64_t prev_bar_date = 0;
+  ossia::time_signature prev_sig = m.begin()->second;
+  m_barIndex.push_back(0);
+  for (auto it = m.begin() + 1; it != m.end(); ++it)
+  {
+    const auto sig_upper = prev_sig.upper;
+    const auto sig_lower = prev_sig.lower;
+    int64_t this_bar_date = it->first.impl;
+    int32_t quarters = (this_bar_date - prev_bar_date) / ossia::quarter_duration<int64_t>;
+    int32_t bars = quarters / (4. * double(sig_upper) / sig_lower);
+
+    bars_so_far += bars + 1;
+    m_barIndex.push_back(bars_so_far);
+
+    prev_bar_date = this_bar_date;
+    prev_sig = it->second;
+  }
+}
+
 void MusicalGrid::compute(TimeVal timeDelta, ZoomRatio zoom, QRectF sceneRect, TimeVal x0_time)
 {
   SCORE_ASSERT(m_measures);
@@ -15,7 +15,7 @@ public:
   MusicalGrid(Timebars& timebars) : timebars{timebars} { }
 
   Timebars& timebars;
-  void setMeasures(const TimeSignatureMap& m) { m_measures = &m; }
+  void setMeasures(const TimeSignatureMap& m);
 
   struct timings
   {
@@ -32,6 +32,11 @@ public:
   void compute(TimeVal timeDelta, ZoomRatio m_zoomRatio, QRectF sceneRect, TimeVal x0_time);
 
   const TimeSignatureMap* m_measures{};
+
+  // Number of bars elapsed at each signature change of m_measures,
+  // rebuilt only when the signatures change.
+  std::vector<int32_t> m_barIndex;
+  TimeSignatureMap m_indexedMeasures;
 };
 
 }
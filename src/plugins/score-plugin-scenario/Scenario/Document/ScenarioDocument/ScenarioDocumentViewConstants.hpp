@@ -5,6 +5,10 @@ namespace Scenario
 static const constexpr double ScenarioLeftSpace = 0.; // -5
 static const constexpr double IntervalHeaderHeight = 21.;
 
+// Below this width, in pixels, an interval is drawn as a plain line
+// and the layers of its rack are hidden.
+static const constexpr double IntervalLodMinWidth = 4.;
+
 class ItemType
 {
 public:
@@ -107,11 +107,13 @@ const OptionalId<IntervalModel>& StateModel::nextInterval() const
 void StateModel::setNextInterval(const OptionalId<IntervalModel>& id)
 {
   m_nextInterval = id;
+  invalidateAdjacency(*this);
 }
 
 void StateModel::setPreviousInterval(const OptionalId<IntervalModel>& id)
 {
   m_previousInterval = id;
+  invalidateAdjacency(*this);
 }
 
 MessageItemModel& StateModel::messages() const
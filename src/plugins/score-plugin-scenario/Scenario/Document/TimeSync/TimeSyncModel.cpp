@@ -35,6 +35,7 @@ void TimeSyncModel::addEvent(const Id<EventModel>& eventId)
     // TODO this addEvent should be in an outside algorithm.
     auto& theEvent = scenar->event(eventId);
     theEvent.changeTimeSync(this->id());
+    scenar->invalidateAdjacency(*this);
   }
 
   newEvent(eventId);
@@ -46,6 +47,7 @@ bool TimeSyncModel::removeEvent(const Id<EventModel>& eventId)
   if (it != m_events.end())
   {
     m_events.erase(it);
+    invalidateAdjacency(*this);
     eventRemoved(eventId);
     return true;
   }
@@ -57,6 +59,7 @@ void TimeSyncModel::clearEvents()
 {
   auto ev = m_events;
   m_events.clear();
+  invalidateAdjacency(*this);
   for (const auto& e : ev)
     eventRemoved(e);
 }
@@ -80,6 +83,7 @@ const TimeSyncModel::EventIdVec& TimeSyncModel::events() const noexcept
 void TimeSyncModel::setEvents(const TimeSyncModel::EventIdVec& events)
 {
   m_events = events;
+  invalidateAdjacency(*this);
 }
 
 void TimeSyncModel::setExpression(const State::Expression& expression)
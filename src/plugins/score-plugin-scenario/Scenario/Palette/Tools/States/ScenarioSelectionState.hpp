@@ -4,6 +4,7 @@
 #include <Scenario/Document/State/StateView.hpp>
 #include <Scenario/Document/TimeSync/TimeSyncView.hpp>
 #include <Scenario/Process/ScenarioGlobalCommandManager.hpp>
+#include <Scenario/Tools/AreaIndex.hpp>
 
 #include <score/statemachine/CommonSelectionState.hpp>
 
@@ -22,6 +23,10 @@ private:
   const ToolPalette_T& m_parentSM;
   View_T& m_scenarioView;
 
+  // Built when the rubber band starts: the scene does not change while it
+  // is being dragged, so each move only queries the elements it overlaps.
+  AreaIndex<const IdentifiedObjectAbstract*> m_areaIndex;
+
 public:
   SelectionState(
       score::SelectionStack& stack,
@@ -37,7 +42,11 @@ public:
   const QPointF& initialPoint() const { return m_initialPoint; }
   const QPointF& movePoint() const { return m_movePoint; }
 
-  void on_pressAreaSelection() override { m_initialPoint = m_parentSM.scenePoint; }
+  void on_pressAreaSelection() override
+  {
+    m_initialPoint = m_parentSM.scenePoint;
+    buildAreaIndex();
+  }
 
   void on_moveAreaSelection() override
   {
@@ -66,55 +75,41 @@ public:
     m_scenarioView.setSelectionArea(QRectF{});
   }
 
-  void setSelectionArea(const QRectF& area)
+  void buildAreaIndex()
   {
-    using namespace std;
-    Selection sel;
+    m_areaIndex.clear();
 
     auto& presenter = m_parentSM.presenter();
+    auto add = [this](const auto& view, const auto& model) {
+      m_areaIndex.insert(view.boundingRect().translated(view.pos()), &model);
+    };
 
     for (const auto& elt : presenter.getIntervals())
-    {
-      if (area.intersects(elt.view()->boundingRect().translated(elt.view()->pos())))
-      {
-        sel.append(&elt.model());
-      }
-    }
+      add(*elt.view(), elt.model());
 
     if constexpr (std::is_same_v<
                       std::remove_reference_t<decltype(presenter)>,
                       const Scenario::ScenarioPresenter>)
     {
       for (const auto& elt : presenter.getGraphIntervals())
-      {
-        if (area.intersects(elt.boundingRect().translated(elt.pos())))
-        {
-          sel.append(&elt.model());
-        }
-      }
+        add(elt, elt.model());
     }
 
     for (const auto& elt : presenter.getTimeSyncs())
-    {
-      if (area.intersects(elt.view()->boundingRect().translated(elt.view()->pos())))
-      {
-        sel.append(&elt.model());
-      }
-    }
+      add(*elt.view(), elt.model());
     for (const auto& elt : presenter.getEvents())
-    {
-      if (area.intersects(elt.view()->boundingRect().translated(elt.view()->pos())))
-      {
-        sel.append(&elt.model());
-      }
-    }
+      add(*elt.view(), elt.model());
     for (const auto& elt : presenter.getStates())
-    {
-      if (area.intersects(elt.view()->boundingRect().translated(elt.view()->pos())))
-      {
-        sel.append(&elt.model());
-      }
-    }
+      add(*elt.view(), elt.model());
+
+    m_areaIndex.build();
+  }
+
+  void setSelectionArea(const QRectF& area)
+  {
+    Selection sel;
+    m_areaIndex.intersecting(
+        area, [&](const IdentifiedObjectAbstract* obj) { sel.append(obj); });
 
     dispatcher.setAndCommit(
         filterSelections(sel, m_parentSM.model().selectedChildren(), multiSelection()));
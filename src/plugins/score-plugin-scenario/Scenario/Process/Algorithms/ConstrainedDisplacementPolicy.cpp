@@ -1,5 +1,9 @@
 #include "ConstrainedDisplacementPolicy.hpp"
 
+#include <Scenario/Document/Interval/IntervalModel.hpp>
+#include <Scenario/Process/Algorithms/IntervalAdjacency.hpp>
+#include <Scenario/Process/ScenarioModel.hpp>
+
 namespace Scenario
 {
 
@@ -20,22 +24,24 @@ void ConstrainedDisplacementPolicy::computeDisplacement(
     return;
   auto tn_id = draggedElements[0];
   auto& tn = scenario.timeSyncs.at(tn_id);
-  const auto& intervalsBefore = Scenario::previousNonGraphIntervals(tn, scenario);
-  const auto& intervalsAfter = Scenario::nextNonGraphIntervals(tn, scenario);
-  QObjectList processesToSave;
+  const auto& adjacency = scenario.adjacency();
+  const auto& intervalsBefore = adjacency.previousIntervals(tn);
+  const auto& intervalsAfter = adjacency.nextIntervals(tn);
+  bool contentSaved = false;
 
   // 1. Find the delta bounds.
   // We have to stop as soon as a interval would become too small.
   TimeVal min{TimeVal::infinity};
   TimeVal max{TimeVal::infinity};
-  for (const auto& id : intervalsBefore)
+  for (const IntervalModel* itv : intervalsBefore)
   {
-    auto it = elementsProperties.intervals.find(id);
+    if (itv->graphal())
+      continue;
+
+    auto it = elementsProperties.intervals.find(itv->id());
     if (it == elementsProperties.intervals.end())
     {
-      auto& c = scenario.intervals.at(id);
-      for (auto& proc : c.processes)
-        processesToSave.append(&proc);
+      auto& c = *itv;
       if (c.duration.defaultDuration() < min)
         min = c.duration.defaultDuration();
     }
@@ -47,14 +53,15 @@ void ConstrainedDisplacementPolicy::computeDisplacement(
     }
   }
 
-  for (const auto& id : intervalsAfter)
+  for (const IntervalModel* itv : intervalsAfter)
   {
-    auto it = elementsProperties.intervals.find(id);
+    if (itv->graphal())
+      continue;
+
+    auto it = elementsProperties.intervals.find(itv->id());
     if (it == elementsProperties.intervals.end())
     {
-      auto& c = scenario.intervals.at(id);
-      for (auto& proc : c.processes)
-        processesToSave.append(&proc);
+      auto& c = *itv;
       if (c.duration.defaultDuration() < max)
         max = c.duration.defaultDuration();
     }
@@ -66,14 +73,6 @@ void ConstrainedDisplacementPolicy::computeDisplacement(
     }
   }
 
-  // Save cables
-
-  if (!processesToSave.empty())
-  {
-    elementsProperties.cables
-        = Dataflow::saveCables(processesToSave, score::IDocument::documentContext(scenario));
-  }
-
   // 2. Rescale deltaTime
   auto dt = deltaTime;
   if (min != TimeVal{TimeVal::infinity} && dt < TimeVal::zero() && dt < -min)
@@ -85,19 +84,33 @@ void ConstrainedDisplacementPolicy::computeDisplacement(
     dt = max;
   }
 
-  for (auto& id : intervalsBefore)
+  for (IntervalModel* itv : intervalsBefore)
   {
+    if (itv->graphal())
+      continue;
+
+    const auto& id = itv->id();
     auto it = elementsProperties.intervals.find(id);
     if (it != elementsProperties.intervals.end())
     {
       auto& c = it.value();
       c.newMin = std::max(TimeVal::zero(), c.oldMin + dt);
       c.newMax = c.oldMax + dt;
+      if (!c.hasContent() && dt != TimeVal::zero())
+      {
+        c.saveContent(*itv, false);
+        contentSaved = true;
+      }
     }
     else
     {
-      auto& curInterval = scenario.intervals.at(id);
-      IntervalProperties c{curInterval, false};
+      auto& curInterval = *itv;
+      IntervalProperties c{curInterval};
+      if (dt != TimeVal::zero())
+      {
+        c.saveContent(curInterval, false);
+        contentSaved = true;
+      }
       c.oldDefault = curInterval.duration.defaultDuration();
       c.oldMin = curInterval.duration.minDuration();
       c.oldMax = curInterval.duration.maxDuration();
@@ -110,19 +123,33 @@ void ConstrainedDisplacementPolicy::computeDisplacement(
     }
   }
 
-  for (auto& id : intervalsAfter)
+  for (IntervalModel* itv : intervalsAfter)
   {
+    if (itv->graphal())
+      continue;
+
+    const auto& id = itv->id();
     auto it = elementsProperties.intervals.find(id);
     if (it != elementsProperties.intervals.end())
     {
       auto& c = it.value();
       c.newMin = std::max(TimeVal::zero(), c.oldMin - dt);
       c.newMax = c.oldMax - dt;
+      if (!c.hasContent() && dt != TimeVal::zero())
+      {
+        c.saveContent(*itv, false);
+        contentSaved = true;
+      }
     }
     else
     {
-      auto& curInterval = scenario.intervals.at(id);
-      IntervalProperties c{curInterval, false};
+      auto& curInterval = *itv;
+      IntervalProperties c{curInterval};
+      if (dt != TimeVal::zero())
+      {
+        c.saveContent(curInterval, false);
+        contentSaved = true;
+      }
       c.oldDefault = curInterval.duration.defaultDuration();
       c.oldMin = curInterval.duration.minDuration();
       c.oldMax = curInterval.duration.maxDuration();
@@ -136,6 +163,12 @@ void ConstrainedDisplacementPolicy::computeDisplacement(
     }
   }
 
+  // Save cables
+  if (contentSaved)
+  {
+    CommonDisplacementPolicy::saveResizedIntervalsCables(scenario, elementsProperties);
+  }
+
   auto it = elementsProperties.timesyncs.find(tn.id());
   if (it != elementsProperties.timesyncs.end())
   {
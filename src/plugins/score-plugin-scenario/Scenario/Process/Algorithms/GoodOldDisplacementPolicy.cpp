@@ -8,6 +8,7 @@
 #include <Scenario/Document/State/StateModel.hpp>
 #include <Scenario/Document/TimeSync/TimeSyncModel.hpp>
 #include <Scenario/Process/Algorithms/Accessors.hpp>
+#include <Scenario/Process/Algorithms/IntervalAdjacency.hpp>
 #include <Scenario/Process/ScenarioModel.hpp>
 #include <Scenario/Tools/dataStructures.hpp>
 
@@ -41,7 +42,7 @@ void GoodOldDisplacementPolicy::computeDisplacement(
   {
     const Id<TimeSyncModel>& firstTimeSyncMovedId = draggedElements.at(0);
     std::vector<Id<TimeSyncModel>> timeSyncsToTranslate;
-    QObjectList processesToSave;
+    bool contentSaved = false;
 
     GoodOldDisplacementPolicy::getRelatedTimeSyncs(
         scenario, firstTimeSyncMovedId, timeSyncsToTranslate);
@@ -67,75 +68,74 @@ void GoodOldDisplacementPolicy::computeDisplacement(
     }
 
     // Make a list of the intervals that need to be resized
+    const auto& adjacency = scenario.adjacency();
     for (const auto& curTimeSyncId : timeSyncsToTranslate)
     {
       auto& curTimeSync = scenario.timeSync(curTimeSyncId);
 
       // each previous interval
-      for (const auto& ev_id : curTimeSync.events())
+      for (IntervalModel* itv : adjacency.previousIntervals(curTimeSync))
       {
-        const auto& ev = scenario.event(ev_id);
-        for (const auto& st_id : ev.states())
+        auto& curInterval = *itv;
+        if (curInterval.graphal())
+          continue;
+
+        const auto& curIntervalId = curInterval.id();
+        // if timesync NOT already in element properties, create new
+        // element properties and set old values
+        auto cur_interval_it = elementsProperties.intervals.find(curIntervalId);
+        if (cur_interval_it == elementsProperties.intervals.end())
         {
-          const auto& st = scenario.states.at(st_id);
-          if (const auto& optCurIntervalId = st.previousInterval())
-          {
-            auto curIntervalId = *optCurIntervalId;
-            auto& curInterval = scenario.intervals.at(curIntervalId);
-            if (curInterval.graphal())
-              continue;
-            // if timesync NOT already in element properties, create new
-            // element properties and set old values
-            auto cur_interval_it = elementsProperties.intervals.find(curIntervalId);
-            if (cur_interval_it == elementsProperties.intervals.end())
-            {
-              IntervalProperties c{curInterval, false};
-              c.oldMin = curInterval.duration.minDuration();
-              c.oldMax = curInterval.duration.maxDuration();
-
-              cur_interval_it
-                  = elementsProperties.intervals.emplace(curIntervalId, std::move(c)).first;
-
-              for (auto& proc : curInterval.processes)
-                processesToSave.append(&proc);
-            }
-
-            auto& curIntervalStartEvent = Scenario::startEvent(curInterval, scenario);
-            auto& startTnodeId = curIntervalStartEvent.timeSync();
-
-            // compute default duration
-            TimeVal date;
-
-            // if prev tnode has moved take updated value else take existing
-            auto it = elementsProperties.timesyncs.find(startTnodeId);
-            if (it != elementsProperties.timesyncs.cend())
-            {
-              date = it.value().newDate;
-            }
-            else
-            {
-              date = curIntervalStartEvent.date();
-            }
-
-            const auto& endDate = elementsProperties.timesyncs[curTimeSyncId].newDate;
-
-            TimeVal newDefaultDuration = endDate - date;
-            TimeVal deltaBounds = newDefaultDuration - curInterval.duration.defaultDuration();
-
-            auto& val = cur_interval_it.value();
-            val.newMin = curInterval.duration.minDuration() + deltaBounds;
-            val.newMax = curInterval.duration.maxDuration() + deltaBounds;
-
-            // nothing to do for now
-          }
+          // Only the dates are saved here : most intervals are just
+          // translated, their content is saved once they get resized.
+          IntervalProperties c{curInterval};
+          c.oldDefault = curInterval.duration.defaultDuration();
+          c.oldMin = curInterval.duration.minDuration();
+          c.oldMax = curInterval.duration.maxDuration();
+
+          cur_interval_it
+              = elementsProperties.intervals.emplace(curIntervalId, std::move(c)).first;
+        }
+
+        auto& curIntervalStartEvent = Scenario::startEvent(curInterval, scenario);
+        auto& startTnodeId = curIntervalStartEvent.timeSync();
+
+        // compute default duration
+        TimeVal date;
+
+        // if prev tnode has moved take updated value else take existing
+        auto it = elementsProperties.timesyncs.find(startTnodeId);
+        if (it != elementsProperties.timesyncs.cend())
+        {
+          date = it.value().newDate;
+        }
+        else
+        {
+          date = curIntervalStartEvent.date();
+        }
+
+        const auto& endDate = elementsProperties.timesyncs[curTimeSyncId].newDate;
+
+        TimeVal newDefaultDuration = endDate - date;
+        TimeVal deltaBounds = newDefaultDuration - curInterval.duration.defaultDuration();
+
+        auto& val = cur_interval_it.value();
+        val.newMin = curInterval.duration.minDuration() + deltaBounds;
+        val.newMax = curInterval.duration.maxDuration() + deltaBounds;
+
+        // The processes will be rescaled: save them while they are
+        // still in their original state.
+        if (!val.hasContent() && newDefaultDuration != val.oldDefault)
+        {
+          val.saveContent(curInterval, false);
+          contentSaved = true;
         }
       }
     }
 
-    if (!processesToSave.empty())
+    if (contentSaved)
     {
-      elementsProperties.cables
-          = Dataflow::saveCables(processesToSave, score::IDocument::documentContext(scenario));
+      CommonDisplacementPolicy::saveResizedIntervalsCables(scenario, elementsProperties);
     }
   }
 }
@@ -145,39 +145,33 @@ void GoodOldDisplacementPolicy::getRelatedTimeSyncs(
     const Id<TimeSyncModel>& firstTimeSyncMovedId,
     std::vector<Id<TimeSyncModel>>& translatedTimeSyncs)
 {
-  if (firstTimeSyncMovedId.val() == Scenario::startId_val)
-    return;
+  const auto& adjacency = scenario.adjacency();
 
-  auto it
-      = std::find(translatedTimeSyncs.begin(), translatedTimeSyncs.end(), firstTimeSyncMovedId);
-  if (it == translatedTimeSyncs.end())
-  {
-    translatedTimeSyncs.push_back(firstTimeSyncMovedId);
-  }
-  else // timeSync already moved
-  {
-    return;
-  }
+  score::hash_map<const TimeSyncModel*, bool> visited;
+  for (const auto& id : translatedTimeSyncs)
+    visited[&scenario.timeSyncs.at(id)] = true;
 
-  const auto& cur_timeSync = scenario.timeSyncs.at(firstTimeSyncMovedId);
-  for (const auto& cur_eventId : cur_timeSync.events())
+  // Depth-first traversal of the following time syncs, in the same order
+  // than the previous recursive implementation.
+  std::vector<const TimeSyncModel*> stack{&scenario.timeSyncs.at(firstTimeSyncMovedId)};
+  while (!stack.empty())
   {
-    const auto& cur_event = scenario.events.at(cur_eventId);
+    const TimeSyncModel* cur_timeSync = stack.back();
+    stack.pop_back();
 
-    for (const auto& state_id : cur_event.states())
+    if (cur_timeSync->id().val() == Scenario::startId_val)
+      continue;
+    if (!visited.insert({cur_timeSync, true}).second)
+      continue;
+
+    translatedTimeSyncs.push_back(cur_timeSync->id());
+
+    const auto& next = adjacency.nextIntervals(*cur_timeSync);
+    for (auto it = next.rbegin(); it != next.rend(); ++it)
     {
-      const auto& state = scenario.states.at(state_id);
-      if (const auto& cons = state.nextInterval())
-      {
-        const auto& itv = scenario.intervals.at(*cons);
-        if (Q_LIKELY(!itv.graphal()))
-        {
-          const auto& endStateId = itv.endState();
-          const auto& endTnId
-              = scenario.events.at(scenario.state(endStateId).eventId()).timeSync();
-          getRelatedTimeSyncs(scenario, endTnId, translatedTimeSyncs);
-        }
-      }
+      const IntervalModel& itv = **it;
+      if (Q_LIKELY(!itv.graphal()))
+        stack.push_back(&Scenario::endTimeSync(itv, scenario));
     }
   }
 }
@@ -0,0 +1,149 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "IntervalAdjacency.hpp"
+
+#include <Scenario/Process/ScenarioModel.hpp>
+
+namespace Scenario
+{
+IntervalAdjacency::IntervalAdjacency(const ProcessModel& scenario) : m_scenario{scenario}
+{
+  scenario.intervals.added.connect<&IntervalAdjacency::on_intervalChanged>(this);
+  scenario.intervals.removed.connect<&IntervalAdjacency::on_intervalChanged>(this);
+  scenario.states.added.connect<&IntervalAdjacency::on_stateChanged>(this);
+  scenario.states.removed.connect<&IntervalAdjacency::on_stateChanged>(this);
+  scenario.events.added.connect<&IntervalAdjacency::on_eventChanged>(this);
+  scenario.events.removed.connect<&IntervalAdjacency::on_eventChanged>(this);
+  scenario.timeSyncs.added.connect<&IntervalAdjacency::on_timeSyncAdded>(this);
+  scenario.timeSyncs.removed.connect<&IntervalAdjacency::on_timeSyncRemoved>(this);
+}
+
+IntervalAdjacency::~IntervalAdjacency() { }
+
+const std::vector<IntervalModel*>&
+IntervalAdjacency::previousIntervals(const TimeSyncModel& ts) const
+{
+  return links(ts).previous;
+}
+
+const std::vector<IntervalModel*>& IntervalAdjacency::nextIntervals(const TimeSyncModel& ts) const
+{
+  return links(ts).next;
+}
+
+void IntervalAdjacency::invalidate(const TimeSyncModel& ts) noexcept
+{
+  invalidate(ts.id());
+}
+
+void IntervalAdjacency::invalidate(const Id<TimeSyncModel>& ts) noexcept
+{
+  if (m_dirty)
+    return;
+
+  // The same time sync is generally notified a few times in a row.
+  // Past a few dozen, e.g. when pasting or merging, a rebuild is as cheap.
+  if (!m_outdated.empty() && m_outdated.back() == ts)
+    return;
+  if (m_outdated.size() >= 64)
+  {
+    m_outdated.clear();
+    m_dirty = true;
+    return;
+  }
+  m_outdated.push_back(ts);
+}
+
+void IntervalAdjacency::invalidateState(const Id<StateModel>& st_id) noexcept
+{
+  // The elements may be removed in any order
+  auto st = m_scenario.findState(st_id);
+  auto ev = st ? m_scenario.findEvent(st->eventId()) : nullptr;
+  if (ev)
+    invalidate(ev->timeSync());
+  else
+    m_dirty = true;
+}
+
+void IntervalAdjacency::on_intervalChanged(const IntervalModel& itv)
+{
+  invalidateState(itv.startState());
+  invalidateState(itv.endState());
+}
+
+void IntervalAdjacency::on_stateChanged(const StateModel& st)
+{
+  if (auto ev = m_scenario.findEvent(st.eventId()))
+    invalidate(ev->timeSync());
+  else
+    m_dirty = true;
+}
+
+void IntervalAdjacency::on_eventChanged(const EventModel& ev)
+{
+  invalidate(ev.timeSync());
+}
+
+void IntervalAdjacency::on_timeSyncAdded(const TimeSyncModel& ts)
+{
+  invalidate(ts.id());
+}
+
+void IntervalAdjacency::on_timeSyncRemoved(const TimeSyncModel& ts)
+{
+  m_links.erase(&ts);
+}
+
+const IntervalAdjacency::Links& IntervalAdjacency::links(const TimeSyncModel& ts) const
+{
+  if (m_dirty)
+  {
+    rebuild();
+  }
+  else if (!m_outdated.empty())
+  {
+    for (const auto& id : m_outdated)
+      if (auto outdated = m_scenario.findTimeSync(id))
+        update(*outdated);
+    m_outdated.clear();
+  }
+
+  auto it = m_links.find(&ts);
+  SCORE_ASSERT(it != m_links.end());
+  return it->second;
+}
+
+void IntervalAdjacency::rebuild() const
+{
+  m_links.clear();
+  m_outdated.clear();
+  m_links.reserve(m_scenario.timeSyncs.size());
+
+  for (const TimeSyncModel& ts : m_scenario.timeSyncs)
+    update(ts);
+
+  m_dirty = false;
+}
+
+void IntervalAdjacency::update(const TimeSyncModel& ts) const
+{
+  Links& l = m_links[&ts];
+  l.previous.clear();
+  l.next.clear();
+
+  // Same traversal than the accessors in Accessors.hpp,
+  // in order to give the same results in the same order.
+  for (const Id<EventModel>& event_id : ts.events())
+  {
+    const EventModel& ev = m_scenario.events.at(event_id);
+    for (const Id<StateModel>& state_id : ev.states())
+    {
+      const StateModel& st = m_scenario.states.at(state_id);
+      if (const auto& prev = st.previousInterval())
+        l.previous.push_back(&m_scenario.intervals.at(*prev));
+      if (const auto& next = st.nextInterval())
+        l.next.push_back(&m_scenario.intervals.at(*next));
+    }
+  }
+}
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <score/model/Identifier.hpp>
+#include <score/tools/std/HashMap.hpp>
+
+#include <nano_observer.hpp>
+#include <score_plugin_scenario_export.h>
+
+#include <vector>
+
+namespace Scenario
+{
+class IntervalModel;
+class StateModel;
+class EventModel;
+class TimeSyncModel;
+class ProcessModel;
+
+/**
+ * @brief Cached links between the time syncs and intervals of a scenario.
+ *
+ * Equivalent to Scenario::previousIntervals / Scenario::nextIntervals,
+ * without walking the events and states on each call.
+ * The entries of the time syncs of the elements which have been added,
+ * removed or re-linked in the scenario are updated lazily ; the whole cache
+ * is rebuilt when too many of them changed at once.
+ */
+class SCORE_PLUGIN_SCENARIO_EXPORT IntervalAdjacency : public Nano::Observer
+{
+public:
+  struct Links
+  {
+    std::vector<IntervalModel*> previous;
+    std::vector<IntervalModel*> next;
+  };
+
+  explicit IntervalAdjacency(const ProcessModel& scenario);
+  ~IntervalAdjacency();
+
+  const std::vector<IntervalModel*>& previousIntervals(const TimeSyncModel& ts) const;
+  const std::vector<IntervalModel*>& nextIntervals(const TimeSyncModel& ts) const;
+
+  void invalidate() noexcept { m_dirty = true; }
+  //! The intervals starting or ending at ts changed
+  void invalidate(const TimeSyncModel& ts) noexcept;
+
+private:
+  void on_intervalChanged(const IntervalModel&);
+  void on_stateChanged(const StateModel&);
+  void on_eventChanged(const EventModel&);
+  void on_timeSyncAdded(const TimeSyncModel&);
+  void on_timeSyncRemoved(const TimeSyncModel&);
+
+  void invalidate(const Id<TimeSyncModel>& ts) noexcept;
+  void invalidateState(const Id<StateModel>& st) noexcept;
+
+  const Links& links(const TimeSyncModel& ts) const;
+  void rebuild() const;
+  void update(const TimeSyncModel& ts) const;
+
+  const ProcessModel& m_scenario;
+  mutable score::hash_map<const TimeSyncModel*, Links> m_links;
+  mutable std::vector<Id<TimeSyncModel>> m_outdated;
+  mutable bool m_dirty{true};
+};
+}
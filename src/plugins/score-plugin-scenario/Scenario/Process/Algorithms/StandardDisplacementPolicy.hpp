@@ -25,6 +25,23 @@ class ProcessModel;
 class CommonDisplacementPolicy
 {
 public:
+  //! Saves the cables of the intervals whose content has been saved
+  static void
+  saveResizedIntervalsCables(Scenario::ProcessModel& scenario, ElementsProperties& props)
+  {
+    QObjectList processes;
+    for (auto& e : props.intervals)
+    {
+      if (e.second.hasContent())
+      {
+        for (auto& proc : scenario.intervals.at(e.first).processes)
+          processes.append(&proc);
+      }
+    }
+
+    props.cables = Dataflow::saveCables(processes, score::IDocument::documentContext(scenario));
+  }
+
   template <typename ProcessScaleMethod>
   static void updatePositions(
       Scenario::ProcessModel& scenario,
@@ -132,6 +149,13 @@ public:
       curIntervalToUpdate.duration.setMinDuration(curIntervalPropertiesToUpdate.oldMin);
       curIntervalToUpdate.duration.setMaxDuration(curIntervalPropertiesToUpdate.oldMax);
 
+      // Intervals which were only translated kept their content.
+      if (!curIntervalPropertiesToUpdate.hasContent())
+      {
+        scenario.intervalMoved(curIntervalToUpdate);
+        continue;
+      }
+
       // Now we have to restore the state of each interval that might have
       // been modified
       // during this command.
@@ -0,0 +1,166 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "TimeSyncDates.hpp"
+
+#include <Scenario/Process/ScenarioModel.hpp>
+
+#include <ossia/detail/algorithms.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace Scenario
+{
+namespace
+{
+// Past this many moved time syncs, the dates are scanned until the moves stop
+static constexpr std::size_t max_moved = 16;
+static constexpr int settle_delay_ms = 500;
+}
+
+TimeSyncDates::TimeSyncDates(const ProcessModel& scenario) : m_scenario{scenario}
+{
+  scenario.timeSyncs.added.connect<&TimeSyncDates::on_added>(this);
+  scenario.timeSyncs.removed.connect<&TimeSyncDates::on_removed>(this);
+
+  // When loading, the time syncs already exist
+  for (const TimeSyncModel& ts : scenario.timeSyncs)
+  {
+    QObject::connect(
+        &ts, &TimeSyncModel::dateChanged, &m_context, [this, &ts] { on_moved(ts); });
+  }
+
+  m_settle.setSingleShot(true);
+  m_settle.setInterval(settle_delay_ms);
+  QObject::connect(&m_settle, &QTimer::timeout, &m_context, [this] { on_settled(); });
+}
+
+TimeSyncDates::~TimeSyncDates() { }
+
+void TimeSyncDates::on_added(const TimeSyncModel& ts)
+{
+  QObject::connect(
+      &ts, &TimeSyncModel::dateChanged, &m_context, [this, &ts] { on_moved(ts); });
+  on_moved(ts);
+}
+
+void TimeSyncDates::on_removed(const TimeSyncModel&)
+{
+  m_dirty = true;
+}
+
+void TimeSyncDates::on_moved(const TimeSyncModel& ts)
+{
+  if (m_overflow)
+  {
+    m_recentlyMoved = true;
+    return;
+  }
+
+  if (m_dirty || isMoved(&ts))
+    return;
+
+  // e.g. when dragging a time sync shifts all the following ones:
+  // re-sorting on each mouse move would cost more than scanning the dates,
+  // thus the array is only rebuilt once the moves stop.
+  if (m_moved.size() >= max_moved)
+  {
+    m_moved.clear();
+    m_overflow = true;
+    m_recentlyMoved = false;
+    m_settle.start();
+    return;
+  }
+  m_moved.push_back(&ts);
+}
+
+void TimeSyncDates::on_settled()
+{
+  if (std::exchange(m_recentlyMoved, false))
+  {
+    m_settle.start();
+    return;
+  }
+
+  m_overflow = false;
+  m_dirty = true;
+}
+
+bool TimeSyncDates::isMoved(const TimeSyncModel* ts) const noexcept
+{
+  return ossia::contains(m_moved, ts);
+}
+
+void TimeSyncDates::rebuild() const
+{
+  m_sorted.clear();
+  m_moved.clear();
+  m_sorted.reserve(m_scenario.timeSyncs.size());
+  for (const TimeSyncModel& ts : m_scenario.timeSyncs)
+    m_sorted.push_back({ts.date(), &ts});
+
+  std::sort(m_sorted.begin(), m_sorted.end(), [](const Entry& lhs, const Entry& rhs) {
+    return lhs.date < rhs.date;
+  });
+  m_dirty = false;
+}
+
+std::optional<TimeVal> TimeSyncDates::closest(TimeVal t, const TimeSyncModel* ignored) const
+{
+  std::optional<TimeVal> res;
+  auto consider = [&](TimeVal date) {
+    if (!res || std::abs(date.impl - t.impl) < std::abs(res->impl - t.impl))
+      res = date;
+  };
+
+  if (m_overflow)
+  {
+    for (const TimeSyncModel& ts : m_scenario.timeSyncs)
+    {
+      if (&ts != ignored)
+        consider(ts.date());
+    }
+    return res;
+  }
+
+  if (m_dirty)
+    rebuild();
+  auto valid
+      = [&](const Entry& e) { return e.sync != ignored && !isMoved(e.sync); };
+
+  const auto it = std::lower_bound(
+      m_sorted.begin(), m_sorted.end(), t, [](const Entry& e, TimeVal date) {
+        return e.date < date;
+      });
+
+  // Closest valid entry after t
+  for (auto next = it; next != m_sorted.end(); ++next)
+  {
+    if (valid(*next))
+    {
+      consider(next->date);
+      break;
+    }
+  }
+
+  // Closest valid entry before t
+  for (auto prev = it; prev != m_sorted.begin();)
+  {
+    --prev;
+    if (valid(*prev))
+    {
+      consider(prev->date);
+      break;
+    }
+  }
+
+  // Time syncs which moved since the last merge
+  for (auto ts : m_moved)
+  {
+    if (ts != ignored)
+      consider(ts->date());
+  }
+
+  return res;
+}
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <Process/TimeValue.hpp>
+
+#include <QObject>
+#include <QTimer>
+
+#include <nano_observer.hpp>
+#include <score_plugin_scenario_export.h>
+
+#include <optional>
+#include <vector>
+
+namespace Scenario
+{
+class TimeSyncModel;
+class ProcessModel;
+
+/**
+ * @brief Dates of the time syncs of a scenario, sorted for fast lookup.
+ *
+ * Used for magnetism: finding the time sync closest to a date is a binary
+ * search instead of a pass over the whole scenario.
+ *
+ * Time syncs which moved since the last rebuild are kept aside and
+ * checked with their current date, so that dragging a handful of
+ * elements does not require re-sorting everything on each mouse move ;
+ * past a few of them, the dates are scanned until the moves stop and
+ * the array is rebuilt afterwards.
+ */
+class SCORE_PLUGIN_SCENARIO_EXPORT TimeSyncDates : public Nano::Observer
+{
+public:
+  explicit TimeSyncDates(const ProcessModel& scenario);
+  ~TimeSyncDates();
+
+  //! Date of the time sync closest to t, not taking into account ignored
+  std::optional<TimeVal> closest(TimeVal t, const TimeSyncModel* ignored) const;
+
+private:
+  struct Entry
+  {
+    TimeVal date;
+    const TimeSyncModel* sync;
+  };
+
+  void on_added(const TimeSyncModel& ts);
+  void on_removed(const TimeSyncModel& ts);
+  void on_moved(const TimeSyncModel& ts);
+  void on_settled();
+  bool isMoved(const TimeSyncModel* ts) const noexcept;
+
+  void rebuild() const;
+
+  const ProcessModel& m_scenario;
+  QObject m_context;
+  QTimer m_settle;
+  mutable std::vector<Entry> m_sorted;
+  mutable std::vector<const TimeSyncModel*> m_moved;
+  mutable bool m_dirty{true};
+  bool m_overflow{};
+  bool m_recentlyMoved{};
+};
+}
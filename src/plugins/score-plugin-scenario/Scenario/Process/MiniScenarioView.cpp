@@ -7,35 +7,93 @@
 #include <Scenario/Process/ScenarioModel.hpp>
 
 #include <QPainter>
+
+#include <cmath>
 namespace Scenario
 {
 
 MiniScenarioView::MiniScenarioView(const ProcessModel& sc, QGraphicsItem* p)
     : MiniLayer{p}, m_scenario{sc}
 {
-  m_scenario.intervals.added.connect<&MiniScenarioView::on_elementChanged>(this);
-  m_scenario.intervals.removed.connect<&MiniScenarioView::on_elementChanged>(this);
+  m_scenario.intervals.added.connect<&MiniScenarioView::on_intervalAdded>(this);
+  m_scenario.intervals.removed.connect<&MiniScenarioView::on_intervalRemoved>(this);
+
+  connect(&m_scenario, &Scenario::ProcessModel::intervalMoved, this, [=] { invalidate(); });
 
-  connect(&m_scenario, &Scenario::ProcessModel::intervalMoved, this, [=] { update(); });
+  for (const IntervalModel& itv : m_scenario.intervals)
+    connectInterval(itv);
 }
 
-void MiniScenarioView::paint_impl(QPainter* p) const
+void MiniScenarioView::connectInterval(const IntervalModel& itv)
+{
+  connect(&itv.metadata(), &score::ModelMetadata::ColorChanged, this, [=] { invalidate(); });
+  connect(&itv, &IntervalModel::heightPercentageChanged, this, [=] { invalidate(); });
+}
+
+void MiniScenarioView::on_intervalAdded(const IntervalModel& itv)
+{
+  connectInterval(itv);
+
+  // A new interval only adds a line: draw it on top of the existing cache.
+  if (!m_dirty && !m_cache.isNull())
+  {
+    QPainter p{&m_cache};
+    drawInterval(p, itv);
+  }
+  update();
+}
+
+void MiniScenarioView::on_intervalRemoved(const IntervalModel&)
+{
+  invalidate();
+}
+
+void MiniScenarioView::invalidate()
+{
+  m_dirty = true;
+  update();
+}
+
+void MiniScenarioView::drawInterval(QPainter& p, const IntervalModel& c) const
 {
   auto& skin = Process::Style::instance();
   const auto h = 12.;
 
-  for (const Scenario::IntervalModel& c : m_scenario.intervals)
+  const auto& col = c.metadata().getColor();
+  if (&col.getBrush() == &skin.IntervalDefaultBackground())
+    p.setPen(skin.MiniScenarioPen(skin.IntervalHeaderText()));
+  else
+    p.setPen(skin.MiniScenarioPen(c.metadata().getColor().getBrush()));
+
+  auto def = c.duration.defaultDuration().toPixels(zoom());
+  auto st = c.date().toPixels(zoom());
+  auto y = c.heightPercentage();
+  p.drawLine(QPointF{st, 1. + y * h}, QPointF{st + def, 1. + y * h});
+}
+
+void MiniScenarioView::paint_impl(QPainter* p) const
+{
+  const qreal ratio = p->device() ? p->device()->devicePixelRatioF() : 1.;
+  const int w = std::ceil(width() * ratio);
+  const int h = std::ceil(height() * ratio);
+  if (w <= 0 || h <= 0)
+    return;
+
+  if (m_dirty || m_cacheZoom != zoom() || m_cache.width() != w || m_cache.height() != h
+      || m_cache.devicePixelRatio() != ratio)
   {
-    const auto& col = c.metadata().getColor();
-    if (&col.getBrush() == &skin.IntervalDefaultBackground())
-      p->setPen(skin.MiniScenarioPen(skin.IntervalHeaderText()));
-    else
-      p->setPen(skin.MiniScenarioPen(c.metadata().getColor().getBrush()));
-
-    auto def = c.duration.defaultDuration().toPixels(zoom());
-    auto st = c.date().toPixels(zoom());
-    auto y = c.heightPercentage();
-    p->drawLine(QPointF{st, 1. + y * h}, QPointF{st + def, 1. + y * h});
+    m_cache = QImage(w, h, QImage::Format_ARGB32_Premultiplied);
+    m_cache.setDevicePixelRatio(ratio);
+    m_cache.fill(Qt::transparent);
+
+    QPainter cache_painter{&m_cache};
+    for (const Scenario::IntervalModel& c : m_scenario.intervals)
+      drawInterval(cache_painter, c);
+
+    m_cacheZoom = zoom();
+    m_dirty = false;
   }
+
+  p->drawImage(QPointF{0., 0.}, m_cache);
 }
 }
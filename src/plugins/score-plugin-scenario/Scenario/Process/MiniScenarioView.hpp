@@ -2,6 +2,8 @@
 #include <Process/LayerView.hpp>
 #include <Process/TimeValue.hpp>
 
+#include <QImage>
+
 #include <nano_observer.hpp>
 
 namespace Scenario
@@ -14,9 +16,21 @@ public:
   MiniScenarioView(const Scenario::ProcessModel& sc, QGraphicsItem* p);
 
 private:
-  void on_elementChanged(const IntervalModel&) { update(); }
+  void on_intervalAdded(const IntervalModel&);
+  void on_intervalRemoved(const IntervalModel&);
+  void connectInterval(const IntervalModel&);
+  void invalidate();
 
   void paint_impl(QPainter*) const override;
+  void drawInterval(QPainter& p, const IntervalModel& c) const;
+
   const Scenario::ProcessModel& m_scenario;
+
+  // The overview is rendered once and blitted afterwards, so that
+  // repainting the minimap (e.g. when dragging its handles) does not
+  // go through all the intervals of the scenario.
+  mutable QImage m_cache;
+  mutable qreal m_cacheZoom{};
+  mutable bool m_dirty{true};
 };
 }
@@ -1,7 +1,50 @@
 // This is an open source non-commercial project. Dear PVS-Studio, please check
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 #include "ScenarioInterface.hpp"
+
+#include <Scenario/Document/Event/EventModel.hpp>
+#include <Scenario/Document/State/StateModel.hpp>
+#include <Scenario/Document/TimeSync/TimeSyncModel.hpp>
+
 namespace Scenario
 {
 ScenarioInterface::~ScenarioInterface() = default;
+
+void ScenarioInterface::invalidateAdjacency() const noexcept { }
+
+void ScenarioInterface::invalidateAdjacency(const TimeSyncModel&) const noexcept
+{
+  invalidateAdjacency();
+}
+
+void invalidateAdjacency(const TimeSyncModel& ts) noexcept
+{
+  if (auto scenar = dynamic_cast<const ScenarioInterface*>(ts.parent()))
+    scenar->invalidateAdjacency(ts);
+}
+
+void invalidateAdjacency(const EventModel& ev) noexcept
+{
+  if (auto scenar = dynamic_cast<const ScenarioInterface*>(ev.parent()))
+  {
+    // The event may not be in a time sync yet when it is being created
+    if (auto ts = scenar->findTimeSync(ev.timeSync()))
+      scenar->invalidateAdjacency(*ts);
+    else
+      scenar->invalidateAdjacency();
+  }
+}
+
+void invalidateAdjacency(const StateModel& st) noexcept
+{
+  if (auto scenar = dynamic_cast<const ScenarioInterface*>(st.parent()))
+  {
+    auto ev = scenar->findEvent(st.eventId());
+    auto ts = ev ? scenar->findTimeSync(ev->timeSync()) : nullptr;
+    if (ts)
+      scenar->invalidateAdjacency(*ts);
+    else
+      scenar->invalidateAdjacency();
+  }
+}
 }
@@ -34,8 +34,19 @@ public:
   virtual score::IndirectContainer<StateModel> getStates() const = 0;
   virtual score::IndirectContainer<EventModel> getEvents() const = 0;
   virtual score::IndirectContainer<TimeSyncModel> getTimeSyncs() const = 0;
+
+  //! Called when the links between the elements of the scenario change
+  virtual void invalidateAdjacency() const noexcept;
+
+  //! Called when the intervals starting or ending at a time sync change
+  virtual void invalidateAdjacency(const TimeSyncModel& ts) const noexcept;
 };
 
+//! Notifies the parent scenario of the element that its links changed
+SCORE_PLUGIN_SCENARIO_EXPORT void invalidateAdjacency(const TimeSyncModel& ts) noexcept;
+SCORE_PLUGIN_SCENARIO_EXPORT void invalidateAdjacency(const EventModel& ev) noexcept;
+SCORE_PLUGIN_SCENARIO_EXPORT void invalidateAdjacency(const StateModel& st) noexcept;
+
 static const constexpr auto startId_val = 0;
 static const constexpr auto endId_val = 1;
 
@@ -17,7 +17,9 @@
 #include <Scenario/Document/State/StateModel.hpp>
 #include <Scenario/Document/TimeSync/TimeSyncModel.hpp>
 #include <Scenario/Process/Algorithms/Accessors.hpp>
+#include <Scenario/Process/Algorithms/IntervalAdjacency.hpp>
 #include <Scenario/Process/Algorithms/ProcessPolicy.hpp>
+#include <Scenario/Process/Algorithms/TimeSyncDates.hpp>
 #include <Scenario/Process/ScenarioProcessMetadata.hpp>
 
 #include <score/command/Dispatchers/CommandDispatcher.hpp>
@@ -77,7 +79,9 @@ void ProcessModel::init()
   m_inlets.push_back(inlet.get());
   m_outlets.push_back(outlet.get());
 
-  m_graph = std::make_unique<TimenodeGraph>(*this);
+  m_adjacency = std::make_unique<IntervalAdjacency>(*this);
+  m_graph = std::make_unique<TimenodeGraph>(*this, true);
+  m_timeSyncDates = std::make_unique<TimeSyncDates>(*this);
 }
 
 bool ProcessModel::hasCycles() const noexcept
@@ -85,6 +89,21 @@ bool ProcessModel::hasCycles() const noexcept
   return m_graph->hasCycles();
 }
 
+void ProcessModel::invalidateAdjacency() const noexcept
+{
+  // Elements are linked together before init() when loading
+  if (m_adjacency)
+    m_adjacency->invalidate();
+}
+
+void ProcessModel::invalidateAdjacency(const TimeSyncModel& ts) const noexcept
+{
+  if (m_adjacency)
+    m_adjacency->invalidate(ts);
+  if (m_graph)
+    m_graph->relinked(ts);
+}
+
 ProcessModel::~ProcessModel()
 {
   try
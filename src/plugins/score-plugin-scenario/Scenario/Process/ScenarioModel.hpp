@@ -26,6 +26,8 @@
 namespace Scenario
 {
 struct TimenodeGraph;
+class IntervalAdjacency;
+class TimeSyncDates;
 
 /**
  * @brief The core hierarchical and temporal process of score
@@ -59,6 +61,10 @@ public:
   const score::DocumentContext& context() const noexcept { return m_context; }
   void init();
   bool hasCycles() const noexcept;
+  const IntervalAdjacency& adjacency() const noexcept { return *m_adjacency; }
+  const TimeSyncDates& timeSyncDates() const noexcept { return *m_timeSyncDates; }
+  void invalidateAdjacency() const noexcept override;
+  void invalidateAdjacency(const TimeSyncModel& ts) const noexcept override;
 
   ~ProcessModel() override;
 
@@ -182,6 +188,8 @@ private:
   // that goes to the startEvent and add a new state
 
   std::unique_ptr<TimenodeGraph> m_graph;
+  std::unique_ptr<IntervalAdjacency> m_adjacency;
+  std::unique_ptr<TimeSyncDates> m_timeSyncDates;
 };
 }
 // TODO this ought to go in Selection.hpp ?
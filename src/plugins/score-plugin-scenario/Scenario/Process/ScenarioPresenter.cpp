@@ -13,6 +13,7 @@
 #include <Scenario/Commands/Scenario/Creations/CreateTimeSync_Event_State.hpp>
 #include <Scenario/Commands/Scenario/Displacement/MoveCommentBlock.hpp>
 #include <Scenario/Document/Interval/Graph/GraphIntervalPresenter.hpp>
+#include <Scenario/Document/ScenarioDocument/ScenarioDocumentView.hpp>
 #include <Scenario/Document/State/ItemModel/MessageItemModel.hpp>
 #include <Scenario/Process/ScenarioView.hpp>
 #include <State/MessageListSerialization.hpp>
@@ -21,6 +22,7 @@
 
 #include <QAction>
 #include <QDebug>
+#include <QGraphicsView>
 #include <QMenu>
 
 #include <wobjectimpl.h>
@@ -201,6 +203,8 @@ ScenarioPresenter::ScenarioPresenter(
 ScenarioPresenter::~ScenarioPresenter()
 {
   disconnect(m_con);
+  disconnect(m_visibleRectCon);
+  m_runningIntervals.clear();
   m_intervals.remove_all();
   m_states.remove_all();
   m_events.remove_all();
@@ -264,9 +268,33 @@ void ScenarioPresenter::on_zoomRatioChanged(ZoomRatio val)
   if (val <= 0.)
     return;
 
+  // Only the intervals in or near the viewport get their layers rescaled,
+  // the others are caught up when they are scrolled into view.
+  m_pendingZoom.clear();
+  const auto visible = visibleRect();
   for (auto& interval : m_intervals)
   {
-    interval.on_zoomRatioChanged(m_zoomRatio);
+    if (intervalVisible(interval.model(), visible))
+    {
+      interval.on_zoomRatioChanged(m_zoomRatio);
+    }
+    else
+    {
+      interval.on_offscreenZoomRatioChanged(m_zoomRatio);
+      m_pendingZoom.push_back(interval.id());
+    }
+  }
+
+  if (!m_pendingZoom.empty() && !m_visibleRectCon)
+  {
+    if (auto v = qobject_cast<ProcessGraphicsView*>(getView(*m_view)))
+    {
+      m_visibleRectCon = connect(
+          v,
+          &ProcessGraphicsView::visibleRectChanged,
+          this,
+          &ScenarioPresenter::updatePendingZoom);
+    }
   }
   for (auto& interval : m_graphIntervals)
   {
@@ -278,6 +306,67 @@ void ScenarioPresenter::on_zoomRatioChanged(ZoomRatio val)
   }
 }
 
+QRectF ScenarioPresenter::visibleRect() const noexcept
+{
+  auto view = getView(*m_view);
+  if (!view)
+    return {};
+
+  const auto vp = view->viewport()->rect();
+  const QRectF scene_rect{view->mapToScene(vp.topLeft()), view->mapToScene(vp.bottomRight())};
+  const auto r = m_view->mapRectFromScene(scene_rect);
+
+  // Keep a viewport worth of margin on each side so that small scrolls
+  // do not constantly hit intervals with outdated layers
+  return r.adjusted(-r.width(), 0., r.width(), 0.);
+}
+
+bool ScenarioPresenter::intervalVisible(const IntervalModel& itv, const QRectF& visible)
+    const noexcept
+{
+  if (visible.isNull())
+    return true;
+
+  // The interval views may not have been moved to the new zoom level yet
+  const double x0 = itv.date().toPixels(m_zoomRatio);
+  const double x1 = x0 + itv.duration.defaultDuration().toPixels(m_zoomRatio);
+  return x1 >= visible.left() && x0 <= visible.right();
+}
+
+void ScenarioPresenter::updatePendingZoom()
+{
+  if (m_pendingZoom.empty())
+    return;
+
+  const auto visible = visibleRect();
+  ossia::remove_erase_if(m_pendingZoom, [&](const Id<IntervalModel>& id) {
+    auto it = m_intervals.find(id);
+    if (it == m_intervals.end())
+      return true;
+
+    TemporalIntervalPresenter& itv = *it;
+    if (!intervalVisible(itv.model(), visible))
+      return false;
+
+    itv.updateLayersZoom();
+    return true;
+  });
+}
+
+void ScenarioPresenter::flushPendingZoom(TemporalIntervalPresenter& itv)
+{
+  // An offscreen interval may be moved or resized into the viewport
+  // without the view being scrolled
+  if (!itv.layersZoomPending())
+    return;
+
+  if (!intervalVisible(itv.model(), visibleRect()))
+    return;
+
+  itv.updateLayersZoom();
+  ossia::remove_erase(m_pendingZoom, itv.id());
+}
+
 TimeSyncPresenter& ScenarioPresenter::timeSync(const Id<TimeSyncModel>& id) const
 {
   return m_timeSyncs.at(id);
@@ -389,7 +478,13 @@ void ScenarioPresenter::on_timeSyncRemoved(const TimeSyncModel& timeSync)
 void ScenarioPresenter::on_intervalRemoved(const IntervalModel& cvm)
 {
   if (Q_LIKELY(!cvm.graphal()))
+  {
+    ossia::remove_erase(m_pendingZoom, cvm.id());
+    ossia::remove_erase_if(m_runningIntervals, [&](TemporalIntervalPresenter* pres) {
+      return pres->id() == cvm.id();
+    });
     removeElement(m_intervals, cvm.id());
+  }
   else
     removeElement(m_graphIntervals, cvm.id());
 }
@@ -408,15 +503,10 @@ void ScenarioPresenter::on_askUpdate()
 
 void ScenarioPresenter::on_intervalExecutionTimer()
 {
-  // TODO optimize me by storing a list of the currently running intervals
-  // TOOD loop
-
-  for (TemporalIntervalPresenter& cst : m_intervals)
+  for (TemporalIntervalPresenter* pres : m_runningIntervals)
   {
+    TemporalIntervalPresenter& cst = *pres;
     const auto& m = cst.model();
-    if (!m.executing())
-      continue;
-
     auto& v = *cst.view();
     const auto& dur = m.duration;
 
@@ -909,6 +999,15 @@ void ScenarioPresenter::on_intervalCreated(const IntervalModel& interval)
 
     m_viewInterface.on_intervalMoved(*cst_pres);
 
+    if (interval.executing())
+      m_runningIntervals.push_back(cst_pres);
+    con(interval, &IntervalModel::executingChanged, cst_pres, [this, cst_pres](bool running) {
+      if (running)
+        m_runningIntervals.push_back(cst_pres);
+      else
+        ossia::remove_erase(m_runningIntervals, cst_pres);
+    });
+
     con(interval, &IntervalModel::requestHeightChange, this, [this, &interval](double y) {
       updateIntervalVerticalPos(*this, const_cast<IntervalModel&>(interval), y, m_view->height());
     });
@@ -946,7 +1045,12 @@ void ScenarioPresenter::on_intervalCreated(const IntervalModel& interval)
     });
     con(interval, &IntervalModel::dateChanged, this, [=](const TimeVal&) {
       m_viewInterface.on_intervalMoved(*cst_pres);
+      flushPendingZoom(*cst_pres);
     });
+    con(interval.duration,
+        &IntervalDurations::defaultDurationChanged,
+        this,
+        [=](const TimeVal&) { flushPendingZoom(*cst_pres); });
     connect(
         cst_pres, &TemporalIntervalPresenter::askUpdate, this, &ScenarioPresenter::on_askUpdate);
 
@@ -128,6 +128,11 @@ private:
 
   void updateAllElements();
 
+  QRectF visibleRect() const noexcept;
+  bool intervalVisible(const IntervalModel& itv, const QRectF& visible) const noexcept;
+  void updatePendingZoom();
+  void flushPendingZoom(TemporalIntervalPresenter& itv);
+
   ZoomRatio m_zoomRatio{1};
   double m_graphicalScale{1.};
 
@@ -152,6 +157,13 @@ private:
   Scenario::ToolPalette m_sm;
 
   QMetaObject::Connection m_con;
+
+  // Only these are refreshed by on_intervalExecutionTimer
+  std::vector<TemporalIntervalPresenter*> m_runningIntervals;
+
+  // Intervals whose layers have not been rescaled since they were offscreen
+  std::vector<Id<IntervalModel>> m_pendingZoom;
+  QMetaObject::Connection m_visibleRectCon;
 };
 
 const StateModel* furthestSelectedState(const Scenario::ProcessModel& scenario);
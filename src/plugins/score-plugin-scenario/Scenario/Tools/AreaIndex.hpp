@@ -0,0 +1,98 @@
+#pragma once
+#include <QRectF>
+
+#include <algorithm>
+#include <vector>
+
+namespace Scenario
+{
+/**
+ * @brief Static interval tree over the horizontal extent of a set of rects.
+ *
+ * Items are sorted by their left edge and laid out as an implicit
+ * balanced tree, where each node stores the rightmost edge of its subtree.
+ * A query visits only the subtrees which can overlap the requested
+ * horizontal range, that is O(log n + k); the vertical extent is then
+ * checked on each candidate.
+ *
+ * The index is built once and is meant to be used while the scene does
+ * not change, e.g. for the duration of a rubber-band selection.
+ */
+template <typename T>
+class AreaIndex
+{
+public:
+  void clear()
+  {
+    m_items.clear();
+    m_maxRight.clear();
+  }
+
+  void insert(const QRectF& rect, T value) { m_items.push_back({rect.normalized(), value}); }
+
+  void build()
+  {
+    std::sort(m_items.begin(), m_items.end(), [](const Item& lhs, const Item& rhs) {
+      return lhs.rect.left() < rhs.rect.left();
+    });
+    m_maxRight.resize(m_items.size());
+    if (!m_items.empty())
+      buildNode(0, m_items.size());
+  }
+
+  bool empty() const noexcept { return m_items.empty(); }
+
+  //! Calls f(value) for each item whose rect intersects area
+  template <typename F>
+  void intersecting(const QRectF& area, F&& f) const
+  {
+    if (!m_items.empty())
+      queryNode(0, m_items.size(), area.normalized(), f);
+  }
+
+private:
+  struct Item
+  {
+    QRectF rect;
+    T value;
+  };
+
+  qreal buildNode(std::size_t begin, std::size_t end)
+  {
+    const std::size_t mid = begin + (end - begin) / 2;
+    qreal r = m_items[mid].rect.right();
+    if (begin < mid)
+      r = std::max(r, buildNode(begin, mid));
+    if (mid + 1 < end)
+      r = std::max(r, buildNode(mid + 1, end));
+    m_maxRight[mid] = r;
+    return r;
+  }
+
+  template <typename F>
+  void queryNode(std::size_t begin, std::size_t end, const QRectF& area, F& f) const
+  {
+    const std::size_t mid = begin + (end - begin) / 2;
+    // Nothing in this subtree reaches the left of the area
+    if (m_maxRight[mid] < area.left())
+      return;
+
+    if (begin < mid)
+      queryNode(begin, mid, area, f);
+
+    const auto& item = m_items[mid];
+    // Everything from here on starts right of the area
+    if (item.rect.left() > area.right())
+      return;
+
+    if (area.intersects(item.rect))
+      f(item.value);
+
+    if (mid + 1 < end)
+      queryNode(mid + 1, end, area, f);
+  }
+
+  std::vector<Item> m_items;
+  std::vector<qreal> m_maxRight;
+};
+}
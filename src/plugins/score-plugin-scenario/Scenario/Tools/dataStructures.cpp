@@ -22,6 +22,19 @@ namespace Scenario
 IntervalSaveData::IntervalSaveData(const Scenario::IntervalModel& interval, bool saveIntemporal)
     : intervalPath{interval}
 {
+  saveContent(interval, saveIntemporal);
+}
+
+IntervalSaveData::IntervalSaveData(const Scenario::IntervalModel& interval)
+    : intervalPath{interval}
+{
+}
+
+void IntervalSaveData::saveContent(const Scenario::IntervalModel& interval, bool saveIntemporal)
+{
+  processes.clear();
+  racks.clear();
+
   processes.reserve(interval.processes.size());
   if (saveIntemporal)
   {
@@ -39,6 +39,12 @@ struct SCORE_PLUGIN_SCENARIO_EXPORT IntervalSaveData
   IntervalSaveData() = default;
   IntervalSaveData(const IntervalModel&, bool saveIntemporal);
 
+  //! Only records the path : the content is saved later with saveContent.
+  explicit IntervalSaveData(const IntervalModel&);
+
+  void saveContent(const IntervalModel&, bool saveIntemporal);
+  bool hasContent() const noexcept { return !racks.empty(); }
+
   void reload(IntervalModel&) const;
 
   Path<IntervalModel> intervalPath;
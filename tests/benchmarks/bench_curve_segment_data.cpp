@@ -0,0 +1,139 @@
+#include <Curve/CurveConversion.hpp>
+#include <Curve/Segment/CurveSegmentData.hpp>
+#include <Curve/Segment/PointArray/PointArraySegment.hpp>
+#include <Curve/Segment/Power/PowerSegment.hpp>
+
+#include <score/serialization/DataStreamVisitor.hpp>
+#include <score/serialization/VisitorCommon.hpp>
+
+#include <core/application/MinimalApplication.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <vector>
+
+// Copy, read back, convert and serialize the specific data of a recorded curve,
+// as done by the curve commands, the conversion to ossia, and the command stack.
+static constexpr int num_segments = 10000;
+
+static std::vector<Curve::SegmentData>
+make_curve(Curve::SegmentSpecificData (*make_data)(double))
+{
+  const auto& key = Metadata<ConcreteKey_k, Curve::PowerSegment>::get();
+
+  std::vector<Curve::SegmentData> curve;
+  curve.reserve(num_segments);
+  for (int i = 0; i < num_segments; i++)
+  {
+    curve.emplace_back(
+        Id<Curve::SegmentModel>{i},
+        Curve::Point{i / double(num_segments), 0.},
+        Curve::Point{(i + 1) / double(num_segments), 1.},
+        i > 0 ? OptionalId<Curve::SegmentModel>{i - 1} : std::nullopt,
+        i < num_segments - 1 ? OptionalId<Curve::SegmentModel>{i + 1} : std::nullopt,
+        key,
+        make_data(i % 4 + 1.));
+  }
+  return curve;
+}
+
+static Curve::SegmentSpecificData make_qvariant_data(double gamma)
+{
+  return Curve::SegmentSpecificData{QVariant::fromValue(Curve::PowerSegmentData{gamma})};
+}
+
+static Curve::SegmentSpecificData make_variant_data(double gamma)
+{
+  return Curve::makeSegmentSpecificData(Curve::PowerSegmentData{gamma});
+}
+
+// Segment data stored in the QVariant fallback, as before the variant
+static void segment_data_qvariant(benchmark::State& state)
+{
+  const auto curve = make_curve(make_qvariant_data);
+
+  for (auto _ : state)
+  {
+    auto copy = curve;
+    double res = 0.;
+    for (const auto& seg : copy)
+      res += std::get<QVariant>(seg.specificSegmentData).value<Curve::PowerSegmentData>().gamma;
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(segment_data_qvariant);
+
+// Segment data stored directly in the variant
+static void segment_data_variant(benchmark::State& state)
+{
+  const auto curve = make_curve(make_variant_data);
+
+  for (auto _ : state)
+  {
+    auto copy = curve;
+    double res = 0.;
+    for (const auto& seg : copy)
+      res += Curve::segmentSpecificData<Curve::PowerSegmentData>(seg.specificSegmentData)
+                 .gamma;
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(segment_data_variant);
+
+// Segment models created from the data, then converted to an ossia curve
+static void segment_data_to_ossia(benchmark::State& state)
+{
+  const auto curve = make_curve(make_variant_data);
+
+  for (auto _ : state)
+  {
+    std::vector<std::unique_ptr<Curve::SegmentModel>> segments;
+    segments.reserve(curve.size());
+    for (const auto& seg : curve)
+      segments.push_back(std::make_unique<Curve::PowerSegment>(seg, nullptr));
+
+    auto res = Engine::score_to_ossia::floatCurve(segments, {});
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(segment_data_to_ossia);
+
+// Recorded point array turned into linear segments
+static void point_array_to_linear(benchmark::State& state)
+{
+  Curve::PointArraySegment segment{Id<Curve::SegmentModel>{0}, nullptr};
+  for (int i = 0; i <= num_segments; i++)
+    segment.addPoint(i / double(num_segments), (i % 100) / 100.);
+
+  for (auto _ : state)
+  {
+    auto res = segment.toLinearSegments();
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(point_array_to_linear);
+
+// Round trip through DataStream, as done by the curve commands
+static void segment_data_datastream(benchmark::State& state)
+{
+  const auto curve = make_curve(make_variant_data);
+
+  for (auto _ : state)
+  {
+    auto arr = score::marshall<DataStream>(curve);
+    auto res = score::unmarshall<std::vector<Curve::SegmentData>>(arr);
+    benchmark::DoNotOptimize(res);
+  }
+}
+BENCHMARK(segment_data_datastream);
+
+int main(int argc, char** argv)
+{
+  // The segment factories are needed to serialize the segment data
+  score::MinimalApplication app(argc, argv);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}